@@ -0,0 +1,93 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <iomanip>
+#include <utility>
+
+namespace indie::bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Result of a single measurement.
+     *
+     */
+    struct Result
+    {
+        const char *Name;
+        std::size_t Operations;
+        double TotalNs;
+
+        /**
+         * @brief Gets the average time spent by one operation.
+         *
+         * @return Nanoseconds per operation.
+         */
+        double NsPerOp() const noexcept
+        {
+            return Operations ? TotalNs / Operations : 0.0;
+        }
+    };
+
+    /**
+     * @brief Prevents the compiler from optimizing away a computed value.
+     *
+     * @tparam T Type of the value.
+     * @param value Value to keep alive.
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T &value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void *sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief Measures the time spent by a function.
+     *
+     * The function is called once and is expected to run `operations` operations.
+     *
+     * @tparam Func Type of the function to measure.
+     * @param name Name displayed in the report.
+     * @param operations Number of operations done by the function.
+     * @param func Function to measure.
+     * @return The measurement result.
+     */
+    template <typename Func>
+    Result Measure(const char *name, std::size_t operations, Func &&func)
+    {
+        auto start = Clock::now();
+        func();
+        auto stop = Clock::now();
+
+        return Result{name, operations, std::chrono::duration<double, std::nano>(stop - start).count()};
+    }
+
+    /**
+     * @brief Prints a measurement result on the standard output.
+     *
+     * @param result Result to print.
+     */
+    inline void Report(const Result &result)
+    {
+        std::cout << std::left << std::setw(48) << result.Name
+                  << std::right << std::setw(14) << std::fixed << std::setprecision(3) << result.TotalNs / 1e6 << " ms"
+                  << std::setw(14) << std::setprecision(2) << result.NsPerOp() << " ns/op" << std::endl;
+    }
+
+    /*! @copydoc Measure */
+    template <typename Func>
+    Result Run(const char *name, std::size_t operations, Func &&func)
+    {
+        auto result = Measure(name, operations, std::forward<Func>(func));
+
+        Report(result);
+        return result;
+    }
+}
\ No newline at end of file
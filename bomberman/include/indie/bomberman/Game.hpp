@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <chrono>
+#include <cstddef>
 
 #include <indie/log/Logger.hpp>
 #include <indie/ecs/EntityManager.hpp>
@@ -16,12 +18,17 @@ namespace indie::bomberman
         Game();
         ~Game() = default;
 
+    private:
+        static constexpr std::chrono::nanoseconds SimulationStep{std::chrono::nanoseconds{1000000000} / 60};
+        static constexpr std::size_t MaxCatchUpSteps{5};
+        static constexpr std::chrono::nanoseconds FrameStep{std::chrono::nanoseconds{1000000000} / 60};
+
     private:
         bool _is_running{true};
 
         ecs::EntityManager<> _em;
         ecs::SystemManager<> _sm{_em};
 
-        std::shared_ptr<Window> _win;
+        Window *_win;
     };
 }
\ No newline at end of file
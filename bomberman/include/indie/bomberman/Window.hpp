@@ -7,7 +7,7 @@
 
 namespace indie::bomberman
 {
-    class Window : public ecs::System<>
+    class Window : public ecs::System<ecs::InPhase<ecs::Phase::Render>>
     {
     public:
         Window(const wchar_t *title);
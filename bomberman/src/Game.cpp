@@ -5,9 +5,8 @@ namespace indie::bomberman
     Game::Game()
     {
         _win = _sm.Add<Window>(L"Bomberman !");
-        
-        while (_is_running) {
-            _sm.Update();
-        }
+
+        _sm.SetTimestep(ecs::Timestep{SimulationStep, MaxCatchUpSteps, FrameStep});
+        _sm.Run(_is_running);
     }
 }
\ No newline at end of file
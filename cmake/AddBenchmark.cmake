@@ -0,0 +1,8 @@
+macro(ADD_BENCHMARK target_name source)
+    message(STATUS "Add new benchmark: ${target_name}")
+
+    add_executable(${target_name} ${source})
+
+    # Every extra argument is a library to link against
+    target_link_libraries(${target_name} bench ${ARGN})
+endmacro()
\ No newline at end of file
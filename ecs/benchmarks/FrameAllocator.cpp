@@ -0,0 +1,51 @@
+#include <vector>
+#include <iostream>
+#include <memory_resource>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/FrameAllocator.hpp>
+
+static constexpr std::size_t FramesCount = 1000;
+static constexpr std::size_t ListsCount = 500;
+
+/**
+ * @brief Builds the temporary lists of a frame, like neighbor lists of an explosion frontier.
+ *
+ */
+template <typename Vector, typename ...Args>
+static std::size_t Frame(Args &&...args)
+{
+    std::size_t total{0};
+
+    for (std::size_t list = 0; list < ListsCount; ++list) {
+        Vector neighbors{args...};
+        for (std::size_t i = 0; i < 8 + list % 24; ++i) {
+            neighbors.push_back(static_cast<unsigned>(list * i));
+        }
+        total += neighbors.size();
+    }
+    return total;
+}
+
+int main()
+{
+    std::size_t sink{0};
+
+    indie::bench::Run("std::vector (global heap), lists", FramesCount * ListsCount, [&] {
+        for (std::size_t frame = 0; frame < FramesCount; ++frame) {
+            sink += Frame<std::vector<unsigned>>();
+        }
+    });
+
+    indie::ecs::FrameAllocator allocator;
+    indie::bench::Run("std::pmr::vector (frame arena), lists", FramesCount * ListsCount, [&] {
+        for (std::size_t frame = 0; frame < FramesCount; ++frame) {
+            sink += Frame<std::pmr::vector<unsigned>>(allocator.Resource());
+            allocator.Reset();
+        }
+    });
+    indie::bench::DoNotOptimize(sink);
+
+    auto stats = allocator.Stats();
+    std::cout << "    high-water mark " << stats.HighWater << " bytes, capacity " << stats.Capacity << " bytes" << std::endl;
+}
\ No newline at end of file
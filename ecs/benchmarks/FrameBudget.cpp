@@ -0,0 +1,209 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/System.hpp>
+
+static constexpr std::size_t AgentsCount = 4000;
+static constexpr std::size_t BombsCount = 100;
+static constexpr std::size_t FramesCount = 600;
+/*! A wave of bombs explodes every `SpikePeriod` frames */
+static constexpr std::size_t SpikePeriod = 20;
+
+struct Position
+{
+    float X{0};
+    float Y{0};
+};
+
+struct Velocity
+{
+    float DX{1};
+    float DY{0};
+};
+
+struct Health
+{
+    float Value{100};
+};
+
+struct Target
+{
+    float X{0};
+    float Y{0};
+};
+
+static std::uint64_t frame{0};
+
+class MoveSystem : public indie::ecs::System<indie::ecs::Writes<Position>, indie::ecs::Reads<Velocity>, indie::ecs::Query<Position, Velocity>>
+{
+public:
+    virtual void Update() final
+    {
+        for (auto et : _query->Entities) {
+            auto pos = _em->Get<Position>(et);
+            auto vel = _em->Get<Velocity>(et);
+            pos->X = std::fmod(pos->X + vel->DX, 1000.0f);
+            pos->Y = std::fmod(pos->Y + vel->DY, 1000.0f);
+        }
+    }
+};
+
+/**
+ * @brief Applies the blast of every bomb to every agent on spike frames.
+ *
+ */
+class ExplosionSystem : public indie::ecs::System<indie::ecs::Writes<Health>, indie::ecs::Reads<Position>, indie::ecs::Query<Health, Position>>
+{
+public:
+    virtual void Update() final
+    {
+        if (frame % SpikePeriod != 0) {
+            return;
+        }
+        for (std::size_t bomb = 0; bomb < BombsCount; ++bomb) {
+            float bx = static_cast<float>(bomb * 37 % 1000);
+            float by = static_cast<float>(bomb * 91 % 1000);
+            for (auto et : _query->Entities) {
+                auto pos = _em->Get<Position>(et);
+                auto distance = std::sqrt((pos->X - bx) * (pos->X - bx) + (pos->Y - by) * (pos->Y - by));
+                _em->Get<Health>(et)->Value -= 1.0f / (1.0f + distance);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Re-plans the target of every agent, resumable across frames.
+ *
+ */
+class AiSystem : public indie::ecs::System<indie::ecs::Writes<Target>, indie::ecs::Reads<Position>, indie::ecs::Query<Target, Position>, indie::ecs::Deferrable<1>>
+{
+public:
+    virtual void Update() final
+    {
+        Resume(std::chrono::nanoseconds::max());
+    }
+
+    virtual bool Resume(std::chrono::nanoseconds budget) final
+    {
+        auto start = indie::bench::Clock::now();
+        auto count = _query->Entities.Size();
+
+        while (_next < count) {
+            Plan(*(_query->Entities.Begin() + _next));
+            ++_next;
+            if (_next % 32 == 0 && indie::bench::Clock::now() - start >= budget) {
+                break;
+            }
+        }
+        if (_next < count) {
+            return false;
+        }
+        _next = 0;
+        ++rounds;
+        return true;
+    }
+
+    std::size_t rounds{0};
+
+private:
+    void Plan(indie::ecs::Entity et)
+    {
+        auto pos = _em->Get<Position>(et);
+        auto target = _em->Get<Target>(et);
+        float x = pos->X;
+        float y = pos->Y;
+
+        // Stands for a path search
+        for (int i = 0; i < 8; ++i) {
+            x = x * 0.99f + std::sin(y) * 3.0f;
+            y = y * 0.99f + std::cos(x) * 3.0f;
+        }
+        target->X = x;
+        target->Y = y;
+    }
+
+    std::size_t _next{0};
+};
+
+class StatsSystem : public indie::ecs::System<indie::ecs::Reads<Health>, indie::ecs::Query<Health>, indie::ecs::Deferrable<0>>
+{
+public:
+    virtual void Update() final
+    {
+        double sum{0};
+        double squares{0};
+
+        for (auto et : _query->Entities) {
+            double value = _em->Get<Health>(et)->Value;
+            sum += value;
+            squares += value * value;
+        }
+        indie::bench::DoNotOptimize(sum);
+        indie::bench::DoNotOptimize(squares);
+    }
+};
+
+static void Run(const char *name, std::chrono::nanoseconds budget)
+{
+    indie::ecs::EntityManager<> em;
+    indie::ecs::SystemManager<> sm{em};
+
+    for (std::size_t i = 0; i < AgentsCount; ++i) {
+        auto et = em.Create();
+        em.Assign<Position>(et, Position{static_cast<float>(i % 1000), static_cast<float>(i / 4)});
+        em.Assign<Velocity>(et);
+        em.Assign<Health>(et);
+        em.Assign<Target>(et);
+    }
+
+    sm.Add<MoveSystem>();
+    sm.Add<ExplosionSystem>();
+    auto ai = sm.Add<AiSystem>();
+    sm.Add<StatsSystem>();
+
+    indie::ecs::Timestep timestep;
+    timestep.Budget = budget;
+    sm.SetTimestep(timestep);
+
+    std::vector<double> times;
+    times.reserve(FramesCount);
+    frame = 0;
+    indie::bench::Run(name, FramesCount, [&]() {
+        for (std::size_t i = 0; i < FramesCount; ++i) {
+            auto start = indie::bench::Clock::now();
+            sm.Update();
+            times.push_back(std::chrono::duration<double, std::milli>(indie::bench::Clock::now() - start).count());
+            ++frame;
+        }
+    });
+
+    double mean{0};
+    for (auto time : times) {
+        mean += time;
+    }
+    mean /= times.size();
+    double variance{0};
+    for (auto time : times) {
+        variance += (time - mean) * (time - mean);
+    }
+    variance /= times.size();
+    std::sort(times.begin(), times.end());
+
+    auto &stats = sm.Deferrals();
+    std::cout << "    mean " << mean << " ms, stddev " << std::sqrt(variance) << " ms, p99 " << times[times.size() * 99 / 100]
+              << " ms, max " << times.back() << " ms" << std::endl
+              << "    AI rounds " << ai->rounds << ", deferred " << stats.Deferred << ", sliced " << stats.Sliced
+              << ", forced " << stats.Forced << ", over budget " << stats.OverBudget << std::endl;
+}
+
+int main()
+{
+    Run("no budget, frames", std::chrono::nanoseconds{0});
+    Run("4 ms budget, frames", std::chrono::milliseconds{4});
+    Run("2 ms budget, frames", std::chrono::milliseconds{2});
+    return 0;
+}
\ No newline at end of file
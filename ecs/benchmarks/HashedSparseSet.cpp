@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <unordered_map>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/details/HashedSparseSet.hpp>
+
+static constexpr std::size_t KeysCount = 1000000;
+
+int main()
+{
+    std::mt19937_64 rng{42};
+    std::vector<std::uint64_t> keys(KeysCount);
+    std::vector<std::uint64_t> misses(KeysCount);
+
+    for (auto &key : keys) {
+        key = rng();
+    }
+    for (auto &key : misses) {
+        key = rng();
+    }
+
+    indie::ecs::details::HashedSparseSet<std::uint64_t> set;
+    std::unordered_map<std::uint64_t, std::size_t> map;
+
+    indie::bench::Run("HashedSparseSet insert", KeysCount, [&] {
+        for (auto key : keys) {
+            set.Insert(key);
+        }
+    });
+    indie::bench::Run("std::unordered_map insert", KeysCount, [&] {
+        for (auto key : keys) {
+            map.emplace(key, map.size());
+        }
+    });
+
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    indie::bench::Run("HashedSparseSet lookup (hit)", KeysCount, [&] {
+        std::size_t found{0};
+        for (auto key : keys) {
+            found += set.IndexOf(key);
+        }
+        indie::bench::DoNotOptimize(found);
+    });
+    indie::bench::Run("std::unordered_map lookup (hit)", KeysCount, [&] {
+        std::size_t found{0};
+        for (auto key : keys) {
+            found += map.find(key)->second;
+        }
+        indie::bench::DoNotOptimize(found);
+    });
+
+    indie::bench::Run("HashedSparseSet lookup (miss)", KeysCount, [&] {
+        std::size_t found{0};
+        for (auto key : misses) {
+            found += set.Has(key);
+        }
+        indie::bench::DoNotOptimize(found);
+    });
+    indie::bench::Run("std::unordered_map lookup (miss)", KeysCount, [&] {
+        std::size_t found{0};
+        for (auto key : misses) {
+            found += map.count(key);
+        }
+        indie::bench::DoNotOptimize(found);
+    });
+
+    indie::bench::Run("HashedSparseSet dense iteration", KeysCount, [&] {
+        std::uint64_t sum{0};
+        for (auto key : set) {
+            sum += key;
+        }
+        indie::bench::DoNotOptimize(sum);
+    });
+    indie::bench::Run("std::unordered_map iteration", KeysCount, [&] {
+        std::uint64_t sum{0};
+        for (auto &pair : map) {
+            sum += pair.first;
+        }
+        indie::bench::DoNotOptimize(sum);
+    });
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include <future>
+#include <thread>
+#include <iostream>
+#include <string>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/JobSystem.hpp>
+
+static constexpr std::size_t RoundTrips = 100000;
+static constexpr std::size_t BatchesCount = 1000;
+static constexpr std::size_t BatchSize = 1024;
+
+/**
+ * @brief Recursive fork-join, each level spawns two jobs and waits for them.
+ *
+ */
+struct Fork
+{
+    indie::ecs::JobSystem *Jobs;
+    unsigned Depth;
+
+    void operator()() const
+    {
+        if (Depth == 0) {
+            return;
+        }
+
+        indie::ecs::JobCounter counter;
+        Jobs->Spawn(counter, Fork{Jobs, Depth - 1});
+        Jobs->Spawn(counter, Fork{Jobs, Depth - 1});
+        Jobs->Wait(counter);
+    }
+};
+
+static void Run(std::size_t workers)
+{
+    indie::ecs::JobSystem jobs{workers};
+    auto prefix = std::to_string(workers) + " worker(s), ";
+
+    indie::bench::Run((prefix + "spawn/wait one job").c_str(), RoundTrips, [&] {
+        for (std::size_t i = 0; i < RoundTrips; ++i) {
+            indie::ecs::JobCounter counter;
+            jobs.Spawn(counter, [] {});
+            jobs.Wait(counter);
+        }
+    });
+
+    std::atomic<std::size_t> sink{0};
+    indie::bench::Run((prefix + "spawn 1024 jobs, wait, per job").c_str(), BatchesCount * BatchSize, [&] {
+        for (std::size_t i = 0; i < BatchesCount; ++i) {
+            indie::ecs::JobCounter counter;
+            jobs.Spawn(counter, BatchSize, [&sink](std::size_t index) {
+                sink.fetch_add(index, std::memory_order_relaxed);
+            });
+            jobs.Wait(counter);
+        }
+    });
+    indie::bench::DoNotOptimize(sink.load());
+
+    // 2^17 - 1 jobs
+    indie::bench::Run((prefix + "fork-join depth 16, per job").c_str(), (std::size_t{1} << 17) - 1, [&] {
+        indie::ecs::JobCounter counter;
+        jobs.Spawn(counter, Fork{&jobs, 16});
+        jobs.Wait(counter);
+    });
+}
+
+int main()
+{
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+
+    indie::bench::Run("std::async round trip (baseline)", RoundTrips / 10, [] {
+        for (std::size_t i = 0; i < RoundTrips / 10; ++i) {
+            std::async(std::launch::async, [] {}).wait();
+        }
+    });
+    for (std::size_t workers : {0, 1, 3}) {
+        Run(workers);
+    }
+}
\ No newline at end of file
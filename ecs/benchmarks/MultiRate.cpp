@@ -0,0 +1,197 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/System.hpp>
+
+static constexpr std::size_t AgentsCount = 4000;
+/*! Ten seconds at 60 Hz */
+static constexpr std::size_t FramesCount = 600;
+
+struct Position
+{
+    float X{0};
+    float Y{0};
+};
+
+struct Velocity
+{
+    float DX{1};
+    float DY{0};
+};
+
+struct Target
+{
+    float X{0};
+    float Y{0};
+};
+
+/**
+ * @brief Rates of the systems of a run.
+ *
+ * Slicing keeps the throughput of a system: it runs `Slices` times more often over `1 / Slices` of the entities.
+ */
+template <unsigned NetHz, unsigned AiHz, std::size_t AiSlices, unsigned StatsHz, std::size_t StatsSlices>
+struct Config
+{
+    static constexpr unsigned Net = NetHz;
+    static constexpr unsigned Ai = AiHz;
+    static constexpr std::size_t AiSlicesCount = AiSlices;
+    static constexpr unsigned Stats = StatsHz;
+    static constexpr std::size_t StatsSlicesCount = StatsSlices;
+};
+
+/*! Every system at every tick */
+using Before = Config<60, 60, 1, 60, 1>;
+/*! Network snapshots at 20 Hz, AI at 10 Hz, stats at 1 Hz */
+using Rates = Config<20, 10, 1, 1, 1>;
+/*! Same rates, AI and stats spread over entity ranges at every tick */
+using RatesSliced = Config<20, 60, 6, 60, 60>;
+
+template <typename C>
+class MoveSystem : public indie::ecs::System<indie::ecs::Writes<Position>, indie::ecs::Reads<Velocity>, indie::ecs::Query<Position, Velocity>,
+                                            indie::ecs::InPhase<indie::ecs::Phase::FixedUpdate>>
+{
+public:
+    virtual void Update() final
+    {
+        for (auto et : this->_query->Entities) {
+            auto pos = this->_em->template Get<Position>(et);
+            auto vel = this->_em->template Get<Velocity>(et);
+            pos->X = std::fmod(pos->X + vel->DX, 1000.0f);
+            pos->Y = std::fmod(pos->Y + vel->DY, 1000.0f);
+        }
+    }
+};
+
+/**
+ * @brief Serializes every position, stands for a network snapshot broadcast.
+ *
+ */
+template <typename C>
+class SnapshotSystem : public indie::ecs::System<indie::ecs::Reads<Position>, indie::ecs::Query<Position>,
+                                                indie::ecs::InPhase<indie::ecs::Phase::FixedUpdate>, indie::ecs::Rate<C::Net>>
+{
+public:
+    virtual void Update() final
+    {
+        _buffer.clear();
+        for (auto et : this->_query->Entities) {
+            auto pos = this->_em->template Get<Position>(et);
+            _buffer.push_back(static_cast<std::uint16_t>(pos->X * 64));
+            _buffer.push_back(static_cast<std::uint16_t>(pos->Y * 64));
+        }
+        indie::bench::DoNotOptimize(_buffer.data());
+    }
+
+private:
+    std::vector<std::uint16_t> _buffer;
+};
+
+/**
+ * @brief Re-plans the target of every agent, stands for a path search.
+ *
+ */
+template <typename C, int N>
+class AiSystem : public indie::ecs::System<indie::ecs::Writes<Target>, indie::ecs::Reads<Position>, indie::ecs::Query<Target, Position>,
+                                           indie::ecs::InPhase<indie::ecs::Phase::FixedUpdate>, indie::ecs::Rate<C::Ai>, indie::ecs::Sliced<C::AiSlicesCount>>
+{
+public:
+    virtual void Update() final
+    {
+        auto [begin, end] = this->SliceRange(this->_query->Entities.Size());
+
+        for (auto i = begin; i < end; ++i) {
+            auto et = *(this->_query->Entities.Begin() + i);
+            auto pos = this->_em->template Get<Position>(et);
+            float x = pos->X;
+            float y = pos->Y;
+            for (int step = 0; step < 16; ++step) {
+                x = x * 0.99f + std::sin(y) * 3.0f;
+                y = y * 0.99f + std::cos(x) * 3.0f;
+            }
+            *this->_em->template Get<Target>(et) = Target{x, y};
+        }
+    }
+};
+
+/**
+ * @brief Computes the median distance to target, sorting a copy of every distance.
+ *
+ */
+template <typename C>
+class StatsSystem : public indie::ecs::System<indie::ecs::Reads<Position, Target>, indie::ecs::Query<Position, Target>,
+                                              indie::ecs::InPhase<indie::ecs::Phase::FixedUpdate>, indie::ecs::Rate<C::Stats>, indie::ecs::Sliced<C::StatsSlicesCount>>
+{
+public:
+    virtual void Update() final
+    {
+        auto [begin, end] = this->SliceRange(this->_query->Entities.Size());
+
+        for (auto i = begin; i < end; ++i) {
+            auto et = *(this->_query->Entities.Begin() + i);
+            auto pos = this->_em->template Get<Position>(et);
+            auto target = this->_em->template Get<Target>(et);
+            _distances.push_back(std::hypot(target->X - pos->X, target->Y - pos->Y));
+        }
+        if (end == this->_query->Entities.Size()) {
+            for (int pass = 0; pass < 8; ++pass) {
+                std::sort(_distances.begin(), _distances.end());
+                std::reverse(_distances.begin(), _distances.end());
+            }
+            indie::bench::DoNotOptimize(_distances[_distances.size() / 2]);
+            _distances.clear();
+        }
+    }
+
+private:
+    std::vector<float> _distances;
+};
+
+template <typename C>
+static void Run(const char *name)
+{
+    indie::ecs::EntityManager<> em;
+    indie::ecs::SystemManager<> sm{em};
+
+    for (std::size_t i = 0; i < AgentsCount; ++i) {
+        auto et = em.Create();
+        em.Assign<Position>(et, Position{static_cast<float>(i % 1000), static_cast<float>(i / 4)});
+        em.Assign<Velocity>(et);
+        em.Assign<Target>(et);
+    }
+
+    sm.template Add<MoveSystem<C>>();
+    sm.template Add<SnapshotSystem<C>>();
+    sm.template Add<AiSystem<C, 0>>();
+    sm.template Add<AiSystem<C, 1>>();
+    sm.template Add<StatsSystem<C>>();
+
+    std::vector<double> times;
+    times.reserve(FramesCount);
+    indie::bench::Run(name, FramesCount, [&]() {
+        for (std::size_t i = 0; i < FramesCount; ++i) {
+            auto start = indie::bench::Clock::now();
+            sm.Update();
+            times.push_back(std::chrono::duration<double, std::micro>(indie::bench::Clock::now() - start).count());
+        }
+    });
+
+    double total{0};
+    for (auto time : times) {
+        total += time;
+    }
+    std::sort(times.begin(), times.end());
+    std::cout << "    per tick: avg " << total / times.size() << " us, p99 " << times[times.size() * 99 / 100]
+              << " us, worst " << times.back() << " us" << std::endl;
+}
+
+int main()
+{
+    Run<Before>("every system at 60 Hz, ticks");
+    Run<Rates>("20/10/1 Hz staggered, ticks");
+    Run<RatesSliced>("20/10/1 Hz sliced over ranges, ticks");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include <iostream>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/System.hpp>
+
+static constexpr std::size_t EntitiesCount = 100000;
+static constexpr std::size_t FramesCount = 200;
+
+struct Position
+{
+    float X{0};
+};
+
+struct Velocity
+{
+    float DX{1};
+};
+
+struct Sleeping
+{};
+
+/**
+ * @brief Moves entities found by filtering every entity at each frame.
+ *
+ */
+class FilterSystem : public indie::ecs::System<indie::ecs::Writes<Position>, indie::ecs::Reads<Velocity>>
+{
+public:
+    virtual void Update() final
+    {
+        _em->ForEach<Position, Velocity>([](auto, Position &pos, Velocity &vel) {
+            pos.X += vel.DX;
+        });
+    }
+};
+
+/**
+ * @brief Moves entities of its cached query.
+ *
+ */
+class QuerySystem : public indie::ecs::System<indie::ecs::Writes<Position>, indie::ecs::Reads<Velocity>, indie::ecs::Query<Position, Velocity>>
+{
+public:
+    virtual void Update() final
+    {
+        auto &positions = _em->Storage<Position>();
+        auto &velocities = _em->Storage<Velocity>();
+
+        for (auto et : _query->Entities) {
+            positions.Get(et)->X += velocities.Get(et)->DX;
+        }
+    }
+};
+
+/**
+ * @brief Wakes sleeping entities, its query is empty in steady state.
+ *
+ */
+class WakeSystem : public indie::ecs::System<indie::ecs::Structural, indie::ecs::Query<Sleeping>>
+{
+public:
+    virtual void Update() final
+    {
+        for (auto i = _query->Entities.Size(); i-- > 0;) {
+            _em->Delete<Sleeping>(*(_query->Entities.Begin() + i));
+        }
+    }
+};
+
+template <typename TSystem>
+static void Run(const char *name, std::size_t moving)
+{
+    indie::ecs::EntityManager<> em;
+    indie::ecs::SystemManager<> sm{em};
+
+    for (std::size_t i = 0; i < EntitiesCount; ++i) {
+        auto et = em.Create();
+        em.Assign<Position>(et);
+        if (i % (EntitiesCount / moving) == 0) {
+            em.Assign<Velocity>(et);
+        }
+    }
+    sm.Add<TSystem>();
+    sm.Add<WakeSystem>();
+
+    auto result = indie::bench::Run(name, FramesCount, [&] {
+        for (std::size_t frame = 0; frame < FramesCount; ++frame) {
+            sm.Update();
+        }
+    });
+    indie::bench::DoNotOptimize(result);
+}
+
+int main()
+{
+    for (std::size_t moving : {100, 10000}) {
+        std::cout << moving << " moving entities out of " << EntitiesCount << std::endl;
+        Run<FilterSystem>("ForEach filter, frames", moving);
+        Run<QuerySystem>("Cached query, frames", moving);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include <iostream>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/ShardedWorld.hpp>
+
+static constexpr std::size_t AgentsCount = 20000;
+static constexpr std::size_t TicksCount = 100;
+static constexpr float MapWidth = 1000.0f;
+
+struct Position
+{
+    Position() = default;
+    Position(float x, float y) : X(x), Y(y) {}
+    float X{0};
+    float Y{0};
+};
+
+struct Velocity
+{
+    Velocity() = default;
+    Velocity(float dx, float dy) : DX(dx), DY(dy) {}
+    float DX{0};
+    float DY{0};
+};
+
+using World = indie::ecs::ShardedWorld<indie::meta::TypeList<Position, Velocity>>;
+
+/**
+ * @brief Steers agents with a deliberately expensive computation, then moves them.
+ *
+ */
+class AgentSystem : public indie::ecs::System<>
+{
+public:
+    AgentSystem(World::Shard &shard, indie::ecs::StripPartition partition) :
+        _shard(shard), _partition(partition)
+    {}
+
+    virtual void Update() final
+    {
+        _leaving.clear();
+        _em->ForEach<Position, Velocity>([&](const auto et, Position &pos, Velocity &vel) {
+            float angle = std::atan2(vel.DY, vel.DX);
+            for (int i = 0; i < 32; ++i) {
+                angle += 0.01f * std::sin(pos.X * 0.01f + angle) * std::cos(pos.Y * 0.01f - angle);
+            }
+            vel.DX = std::cos(angle);
+            vel.DY = std::sin(angle);
+
+            pos.X += vel.DX;
+            pos.Y += vel.DY;
+            if (pos.X < 0 || pos.X >= MapWidth) {
+                vel.DX = -vel.DX;
+                pos.X = std::fmin(std::fmax(pos.X, 0.0f), MapWidth - 1.0f);
+            }
+            if (_partition(pos.X) != _shard.Id()) {
+                _leaving.push_back(et);
+            }
+        });
+        for (auto et : _leaving) {
+            _shard.Migrate(et, _partition(_em->Get<Position>(et)->X));
+        }
+    }
+
+private:
+    World::Shard &_shard;
+    indie::ecs::StripPartition _partition;
+    std::vector<indie::ecs::Entity> _leaving;
+};
+
+static void Run(std::size_t shards)
+{
+    indie::ecs::StripPartition partition{0.0f, MapWidth, shards};
+    World world{shards};
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> coord{0.0f, MapWidth};
+    std::uniform_real_distribution<float> dir{-1.0f, 1.0f};
+
+    world.ForEachShard([&](auto &shard) {
+        shard.Systems().template Add<AgentSystem>(shard, partition);
+    });
+    for (std::size_t i = 0; i < AgentsCount; ++i) {
+        Position pos{coord(rng), coord(rng)};
+        auto shard = partition(pos.X);
+        auto et = World::LocalOf(world.Create(shard));
+        auto &em = world.GetShard(shard).Entities();
+
+        em.Assign<Position>(et, pos);
+        em.Assign<Velocity>(et, dir(rng), dir(rng));
+    }
+
+    auto name = std::to_string(shards) + " shard(s), agent updates";
+    auto result = indie::bench::Run(name.c_str(), AgentsCount * TicksCount, [&] {
+        for (std::size_t tick = 0; tick < TicksCount; ++tick) {
+            world.Update();
+        }
+    });
+    std::cout << "    " << result.TotalNs / 1e6 / TicksCount << " ms/tick, " << world.Size() << " agents settled (in-flight migrations excluded)" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    for (std::size_t shards : {1, 2, 4, 8}) {
+        Run(shards);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <iostream>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/System.hpp>
+#include <indie/ecs/StaticSystemManager.hpp>
+
+static constexpr std::size_t UpdatesCount = 1000000;
+static constexpr std::size_t EntitiesCount = 8;
+
+template <int N>
+struct Value
+{
+    float X{1};
+};
+
+/**
+ * @brief Small system, scales the value of a handful of entities.
+ *
+ */
+template <int N>
+class ScaleSystem : public indie::ecs::System<indie::ecs::Writes<Value<N>>, indie::ecs::Query<Value<N>>>
+{
+public:
+    virtual void Update() override
+    {
+        auto &values = this->_em->template Storage<Value<N>>();
+
+        for (auto et : this->_query->Entities) {
+            auto value = values.Get(et);
+            value->X = value->X * 1.0001f + 0.5f;
+        }
+    }
+};
+
+static void Fill(indie::ecs::EntityManager<> &em)
+{
+    for (std::size_t i = 0; i < EntitiesCount; ++i) {
+        auto et = em.Create();
+        em.Assign<Value<0>>(et);
+        em.Assign<Value<1>>(et);
+        em.Assign<Value<2>>(et);
+        em.Assign<Value<3>>(et);
+        em.Assign<Value<4>>(et);
+        em.Assign<Value<5>>(et);
+        em.Assign<Value<6>>(et);
+        em.Assign<Value<7>>(et);
+    }
+}
+
+static void RunDynamic()
+{
+    indie::ecs::EntityManager<> em;
+    indie::ecs::SystemManager<> sm{em};
+
+    Fill(em);
+    sm.Add<ScaleSystem<0>>();
+    sm.Add<ScaleSystem<1>>();
+    sm.Add<ScaleSystem<2>>();
+    sm.Add<ScaleSystem<3>>();
+    sm.Add<ScaleSystem<4>>();
+    sm.Add<ScaleSystem<5>>();
+    sm.Add<ScaleSystem<6>>();
+    sm.Add<ScaleSystem<7>>();
+
+    indie::bench::Run("SystemManager, 8 systems, updates", UpdatesCount, [&]() {
+        for (std::size_t i = 0; i < UpdatesCount; ++i) {
+            sm.Update();
+        }
+    });
+}
+
+static void RunStatic()
+{
+    using Manager = indie::ecs::StaticSystemManager<ScaleSystem<0>, ScaleSystem<1>, ScaleSystem<2>, ScaleSystem<3>,
+                                                    ScaleSystem<4>, ScaleSystem<5>, ScaleSystem<6>, ScaleSystem<7>>;
+
+    indie::ecs::EntityManager<> em;
+    Manager sm{em};
+
+    Fill(em);
+
+    indie::bench::Run("StaticSystemManager, 8 systems, updates", UpdatesCount, [&]() {
+        for (std::size_t i = 0; i < UpdatesCount; ++i) {
+            sm.Update();
+        }
+    });
+}
+
+int main()
+{
+    RunDynamic();
+    RunStatic();
+    return 0;
+}
\ No newline at end of file
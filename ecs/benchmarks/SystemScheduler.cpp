@@ -0,0 +1,120 @@
+#include <cmath>
+#include <thread>
+#include <iostream>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/ecs/System.hpp>
+
+static constexpr std::size_t EntitiesCount = 20000;
+static constexpr std::size_t FramesCount = 50;
+
+/**
+ * @brief Distinct component types, one per index.
+ *
+ */
+template <int N>
+struct Data
+{
+    float Value{1.0f};
+};
+
+/**
+ * @brief Reads a component and writes another with a deliberately expensive computation.
+ *
+ */
+template <int In, int Out>
+class WorkSystem : public indie::ecs::System<indie::ecs::Reads<Data<In>>, indie::ecs::Writes<Data<Out>>>
+{
+public:
+    virtual void Update() final
+    {
+        this->_em->template ForEach<Data<In>, Data<Out>>([](auto, Data<In> &in, Data<Out> &out) {
+            float value = out.Value;
+            for (int i = 0; i < 8; ++i) {
+                value = std::sqrt(value * value + std::sin(in.Value + static_cast<float>(i)));
+            }
+            out.Value = value;
+        });
+    }
+};
+
+/**
+ * @brief Structural system, forces a sync point.
+ *
+ */
+class SpawnSystem : public indie::ecs::System<indie::ecs::Structural>
+{
+public:
+    virtual void Update() final
+    {
+        _em->Destroy(_em->Create());
+    }
+};
+
+template <int ...N>
+static void Populate(indie::ecs::EntityManager<> &em, std::integer_sequence<int, N...>)
+{
+    for (std::size_t i = 0; i < EntitiesCount; ++i) {
+        auto et = em.Create();
+        (em.Assign<Data<N>>(et), ...);
+    }
+}
+
+template <typename Profiler = indie::ecs::NullProfiler>
+static void Run(std::size_t workers)
+{
+    indie::ecs::EntityManager<> em;
+    indie::ecs::SystemManager<indie::ecs::Entity, Profiler> sm{em, workers};
+
+    Populate(em, std::make_integer_sequence<int, 12>{});
+
+    // 24 systems over 12 components: chains of dependencies mixed with independent work
+    sm.template Add<WorkSystem<0, 1>>();
+    sm.template Add<WorkSystem<2, 3>>();
+    sm.template Add<WorkSystem<4, 5>>();
+    sm.template Add<WorkSystem<6, 7>>();
+    sm.template Add<WorkSystem<8, 9>>();
+    sm.template Add<WorkSystem<10, 11>>();
+    sm.template Add<WorkSystem<1, 0>>();
+    sm.template Add<WorkSystem<3, 2>>();
+    sm.template Add<WorkSystem<5, 4>>();
+    sm.template Add<WorkSystem<7, 6>>();
+    sm.template Add<WorkSystem<9, 8>>();
+    sm.template Add<WorkSystem<11, 10>>();
+    sm.template Add<SpawnSystem>();
+    sm.template Add<WorkSystem<0, 2>>();
+    sm.template Add<WorkSystem<1, 3>>();
+    sm.template Add<WorkSystem<4, 6>>();
+    sm.template Add<WorkSystem<5, 7>>();
+    sm.template Add<WorkSystem<8, 10>>();
+    sm.template Add<WorkSystem<9, 11>>();
+    sm.template Add<WorkSystem<2, 4>>();
+    sm.template Add<WorkSystem<3, 5>>();
+    sm.template Add<WorkSystem<6, 8>>();
+    sm.template Add<WorkSystem<7, 9>>();
+    sm.template Add<WorkSystem<10, 0>>();
+
+    auto name = std::to_string(workers) + " worker(s), 24 systems" + (Profiler::Enabled ? ", profiled" : "") + ", frames";
+    auto result = indie::bench::Run(name.c_str(), FramesCount, [&] {
+        for (std::size_t frame = 0; frame < FramesCount; ++frame) {
+            sm.Update();
+        }
+    });
+    std::cout << "    " << result.TotalNs / 1e6 / FramesCount << " ms/frame, " << sm.Stages() << " stages" << std::endl;
+
+    if constexpr (Profiler::Enabled) {
+        for (auto &timing : sm.GetProfiler().Timings()) {
+            std::cout << "    " << timing.Name << ": min " << timing.Min / 1000 << " us, avg " << timing.Avg / 1000
+                      << " us, p99 " << timing.P99 / 1000 << " us" << std::endl;
+        }
+    }
+}
+
+int main()
+{
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    for (std::size_t workers : {0, 1, 2, 3, 7}) {
+        Run(workers);
+    }
+    Run<indie::ecs::SystemProfiler>(0);
+}
\ No newline at end of file
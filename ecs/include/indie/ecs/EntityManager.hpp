@@ -6,11 +6,18 @@
 #include <tuple>
 #include <functional>
 #include <exception>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <memory>
+#include <utility>
+#include <cstdint>
 
 #include <indie/meta/Tuple.hpp>
 
 #include "./Entity.hpp"
 #include "./Pool.hpp"
+#include "./Signals.hpp"
 #include "./details/SparseSet.hpp"
 
 namespace indie::ecs
@@ -94,19 +101,80 @@ namespace indie::ecs
         PoolsTuple _pools;
     };
 
+    /**
+     * @brief Statistics of a components pool, meant for telemetry.
+     * 
+     */
+    struct PoolStats
+    {
+        /*! Identifier of the pool */
+        std::size_t ID;
+        /*! Number of components */
+        std::size_t Size;
+        /*! Number of components storable without reallocation */
+        std::size_t Capacity;
+        /*! Memory allocated by the pool, in bytes */
+        std::size_t Bytes;
+        /*! Number of components assigned or removed since the last call to `ResetChurn` */
+        std::size_t Churn;
+    };
+
+    /**
+     * @brief Tells what a registry reset does with the allocated storage.
+     * 
+     */
+    enum class ResetMode
+    {
+        /*! Storage is kept for the next entities (e.g. the next level) */
+        KeepCapacity,
+        /*! Storage is freed */
+        Release
+    };
+
+    /**
+     * @brief Entities matching a tracked query, maintained incrementally by the entity manager.
+     * 
+     * @tparam EntityType The type of the entity identifier.
+     */
+    template <typename EntityType = Entity>
+    struct QueryCache
+    {
+        /*! Dense list of the matching entities, in no particular order */
+        details::SparseSet<EntityType> Entities;
+        /*! Incremented each time an entity enters or leaves the list */
+        std::uint64_t Version{0};
+    };
+
     template <typename EntityType = Entity>
     class EntityManager
     {
     private:
+        using BasePoolType = details::SparseSet<EntityType>;
+
         struct PoolData
         {
             using PoolId = std::size_t;
 
-            std::unique_ptr<details::SparseSet<EntityType>> Pool{nullptr};
-            std::function<void(EntityType et)> Delete;
-            std::function<bool(EntityType et)> Has;
+            /*! Pools are destroyed through their real type, the base set has no virtual destructor */
+            std::unique_ptr<BasePoolType, void (*)(BasePoolType *)> Pool{nullptr, nullptr};
+            void (*Delete)(BasePoolType *, EntityType){nullptr};
+            void (*Clear)(BasePoolType *, ResetMode){nullptr};
+            std::size_t (*Capacity)(const BasePoolType *){nullptr};
+            std::size_t (*Bytes)(const BasePoolType *){nullptr};
+            /*! Lifecycle signals, out of line so a pool without listener only pays a branch */
+            void (*EmitAssigned)(event::EventManager &, SignalMode, EntityType){nullptr};
+            void (*EmitReplaced)(event::EventManager &, SignalMode, EntityType){nullptr};
+            void (*EmitDeleted)(event::EventManager &, SignalMode, EntityType){nullptr};
             PoolId ID;
 
+            /*! Receives the lifecycle signals of the pool, null if no one listens */
+            event::EventManager *Signals{nullptr};
+            SignalMode Mode{SignalMode::Immediate};
+
+            /*! Tracked queries involving this pool */
+            std::vector<std::size_t> Queries;
+            std::size_t Churn{0};
+
             /**
              * @brief Generates a compile time unique identifier for a pool.
              * 
@@ -121,6 +189,52 @@ namespace indie::ecs
                 return id;
             }
 
+            /**
+             * @brief Builds the type-erased operations of a pool.
+             * 
+             * @tparam Component Type of the component stored by the pool.
+             * @param id Identifier of the pool.
+             * @return Data of a new pool.
+             */
+            template <typename Component>
+            static PoolData Make(PoolId id)
+            {
+                using Type = ecs::Pool<Component, EntityType>;
+
+                PoolData data;
+                data.Pool = {new Type{}, [](BasePoolType *pool) {
+                    delete static_cast<Type *>(pool);
+                }};
+                data.Delete = [](BasePoolType *pool, EntityType et) {
+                    static_cast<Type *>(pool)->Delete(et);
+                };
+                data.Clear = [](BasePoolType *pool, ResetMode mode) {
+                    if (mode == ResetMode::Release) {
+                        static_cast<Type *>(pool)->Release();
+                    }
+                    else {
+                        static_cast<Type *>(pool)->Reset();
+                    }
+                };
+                data.Capacity = [](const BasePoolType *pool) -> std::size_t {
+                    return static_cast<const Type *>(pool)->Capacity();
+                };
+                data.Bytes = [](const BasePoolType *pool) -> std::size_t {
+                    return static_cast<const Type *>(pool)->Bytes();
+                };
+                data.EmitAssigned = [](event::EventManager &events, SignalMode mode, EntityType et) {
+                    details::EmitSignal<Assigned<Component, EntityType>>(events, mode, et);
+                };
+                data.EmitReplaced = [](event::EventManager &events, SignalMode mode, EntityType et) {
+                    details::EmitSignal<Replaced<Component, EntityType>>(events, mode, et);
+                };
+                data.EmitDeleted = [](event::EventManager &events, SignalMode mode, EntityType et) {
+                    details::EmitSignal<Deleted<Component, EntityType>>(events, mode, et);
+                };
+                data.ID = id;
+                return data;
+            }
+
         private:
             /**
              * @brief Used by `GetPoolId()`
@@ -132,7 +246,8 @@ namespace indie::ecs
              */
             static inline PoolId GeneratePoolId(bool reset = false) noexcept
             {
-                static PoolId cur{0};
+                // Registries may live on different threads
+                static std::atomic<PoolId> cur{0};
 
                 if (reset) {
                     cur = 0;
@@ -140,6 +255,67 @@ namespace indie::ecs
                 return cur++;
             }
         };
+
+        struct QueryData : QueryCache<EntityType>
+        {
+            using QueryId = std::size_t;
+
+            /*! Pools an entity must belong to */
+            std::vector<BasePoolType *> Pools;
+
+            /**
+             * @brief Removes every entity of the list.
+             * 
+             * @param mode Whether the storage of the list is kept or freed.
+             */
+            void Clear(ResetMode mode = ResetMode::KeepCapacity) noexcept
+            {
+                if (this->Entities.Size() != 0) {
+                    ++this->Version;
+                }
+                if (mode == ResetMode::Release) {
+                    this->Entities.Release();
+                }
+                else {
+                    this->Entities.Clear();
+                }
+            }
+
+            /**
+             * @brief Tells if an entity matches this query.
+             * 
+             * @param et A valid entity.
+             * @return True if the entity owns every component of the query.
+             */
+            bool Matches(EntityType et) const noexcept
+            {
+                return std::all_of(Pools.begin(), Pools.end(), [et](const BasePoolType *pool) {
+                    return pool->Has(et);
+                });
+            }
+
+            /**
+             * @brief Generates a compile time unique identifier for a query signature.
+             * 
+             * @tparam Components Types of the components of the query.
+             * @return A unique query identifier.
+             */
+            template <typename ...Components>
+            static inline QueryId GetQueryId() noexcept
+            {
+                static QueryId id{GenerateQueryId()};
+
+                return id;
+            }
+
+        private:
+            static inline QueryId GenerateQueryId() noexcept
+            {
+                static std::atomic<QueryId> cur{0};
+
+                return cur++;
+            }
+        };
     
     public:
         using SizeType = EntityType;
@@ -170,13 +346,8 @@ namespace indie::ecs
         {
             auto pool_id = PoolData::template GetPoolId<Component>();
 
-            auto it = std::find_if(_pools.begin(), _pools.end(), [pool_id](const auto &pool) {
-                return pool.ID == pool_id;
-            });
-
-            if (it != _pools.end()) {
-                auto pool = &(*it);
-                return static_cast<PoolType<Component> *>(pool->Pool.get());
+            if (pool_id < _pools.size()) {
+                return static_cast<const PoolType<Component> *>(_pools[pool_id].Pool.get());
             }
             return nullptr;
         }
@@ -209,36 +380,109 @@ namespace indie::ecs
         PoolType<Component> *TryAllocatePool()
         {
             auto pool_id = PoolData::template GetPoolId<Component>();
-            PoolData *pool = nullptr;
 
-            auto it = std::find_if(_pools.begin(), _pools.end(), [pool_id](const auto &pool) {
-                return pool.ID == pool_id;
-            });
+            // Pools are indexed by their identifier, some slots may stay empty
+            if (pool_id >= _pools.size()) {
+                _pools.resize(pool_id + 1);
+            }
 
-            if (it == _pools.end()) {
-                PoolData pool_data;
-                pool_data.Pool = std::make_unique<PoolType<Component>>();
-                pool_data.ID = pool_id;
-                pool = &_pools.emplace_back(std::move(pool_data));
-                pool->Delete = [=](EntityType et) {
-                    this->GetPool<Component>()->Delete(et);
-                };
-                pool->Has = [=](EntityType et) {
-                    return this->GetPool<Component>()->Has(et);
-                };
+            auto &pool = _pools[pool_id];
+
+            if (!pool.Pool) {
+                pool = PoolData::template Make<Component>(pool_id);
             }
-            else {
-                pool = &(*it);
+            if (!pool.Pool) {
+                throw std::runtime_error("Allocation failed for pool: " + std::to_string(pool_id));
             }
 
-            if (!pool || !pool->Pool) {
-                throw std::runtime_error("Allocation failed for pool: " + std::to_string(pool_id));
+            return static_cast<PoolType<Component> *>(pool.Pool.get());
+        }
+
+        /**
+         * @brief Updates tracked queries before a component is removed from an entity.
+         * 
+         * @param pool Data of the pool losing the component.
+         * @param et A valid entity owning the component.
+         */
+        void OnRemove(PoolData &pool, const EntityType et) noexcept
+        {
+            ++pool.Churn;
+            for (auto query_id : pool.Queries) {
+                auto &query = *_queries[query_id];
+                if (query.Entities.Has(et)) {
+                    query.Entities.Erase(et);
+                    ++query.Version;
+                }
+            }
+        }
+        /**
+         * @brief Updates tracked queries after a component is assigned to an entity.
+         * 
+         * @param pool Data of the pool receiving the component.
+         * @param et A valid entity owning the component.
+         */
+        void OnAssign(PoolData &pool, const EntityType et)
+        {
+            ++pool.Churn;
+            for (auto query_id : pool.Queries) {
+                auto &query = *_queries[query_id];
+                if (query.Matches(et)) {
+                    query.Entities.Insert(et);
+                    ++query.Version;
+                }
             }
+        }
+
+        /**
+         * @brief Gets a tracked query.
+         * 
+         * @tparam Components Types of the components of the query.
+         * @return The query, null if it is not tracked.
+         */
+        template <typename ...Components>
+        const QueryData *GetQuery() const noexcept
+        {
+            auto query_id = QueryData::template GetQueryId<Components...>();
 
-            return static_cast<PoolType<Component> *>(pool->Pool.get());
+            if (query_id < _queries.size()) {
+                return _queries[query_id].get();
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Sends `Deleted` for every component of a connected pool.
+         * 
+         * @param pool_id Identifier of the pool.
+         */
+        void EmitDeletedAll(std::size_t pool_id)
+        {
+            // Backward and bounded, immediate observers may remove components
+            for (auto i = _pools[pool_id].Pool->Size(); i-- > 0;) {
+                auto &pool = _pools[pool_id];
+
+                if (pool.Signals && i < pool.Pool->Size()) {
+                    pool.EmitDeleted(*pool.Signals, pool.Mode, *(pool.Pool->Begin() + i));
+                }
+            }
         }
 
     public:
+        /**
+         * @brief Gets the pool storing a component type.
+         * Allocates it if the pool does not exist.
+         * 
+         * The returned pool stays valid as long as this registry lives.
+         * 
+         * @tparam Component Type of the component stored by the pool.
+         * @return A components pool.
+         */
+        template <typename Component>
+        PoolType<Component> &Storage()
+        {
+            return *TryAllocatePool<Component>();
+        }
+
         /**
          * @brief Creates a new entity.
          * 
@@ -246,11 +490,9 @@ namespace indie::ecs
          */
         EntityType Create()
         {
-            static EntityType ett{0};
-
             if (_deleted_et.Size() == 0) {
-                _entities.Insert(ett);
-                return ett++;
+                _entities.Insert(_next);
+                return _next++;
             }
             else {
                 _entities.Insert(*_deleted_et.Begin());
@@ -271,17 +513,77 @@ namespace indie::ecs
         template <typename Entity, typename ...Entities>
         void Destroy(const Entity et, const Entities ...ets)
         {
-            for (auto &pool : _pools) {
-                if (pool.Has(et)) {
-                    pool.Delete(et);
+            // Indexed, immediate observers may allocate pools
+            for (std::size_t i = 0; i < _pools.size(); ++i) {
+                if (!_pools[i].Pool || !_pools[i].Pool->Has(et)) {
+                    continue;
+                }
+                if (_pools[i].Signals) {
+                    _pools[i].EmitDeleted(*_pools[i].Signals, _pools[i].Mode, et);
+                    if (!_pools[i].Pool->Has(et)) {
+                        continue;
+                    }
                 }
+                OnRemove(_pools[i], et);
+                _pools[i].Delete(_pools[i].Pool.get(), et);
             }
             _entities.Erase(et);
             _deleted_et.Insert(et);
+            if (_destroyed_signals) {
+                details::EmitSignal<Destroyed<EntityType>>(*_destroyed_signals, _destroyed_mode, static_cast<EntityType>(et));
+            }
             if constexpr(sizeof...(Entities) >= 1) {
                 Destroy(ets...);
             }
         }
+        /**
+         * @brief Destroys a batch of entities and their associated components, pool by pool.
+         * 
+         * Each pool is visited once for the whole batch instead of once per entity.
+         * `Deleted` signals of every entity come before the `Destroyed` signals.
+         * 
+         * @warning
+         * Destroying an invalid entity, or an entity twice, is undefined behavior.
+         * 
+         * @tparam It Type of the iterators over the entities.
+         * @param first Iterator to the first entity.
+         * @param last Iterator past the last entity.
+         */
+        template <typename It>
+        void DestroyBatch(It first, It last)
+        {
+            // Indexed, immediate observers may allocate pools
+            for (std::size_t i = 0; i < _pools.size(); ++i) {
+                if (!_pools[i].Pool || _pools[i].Pool->Size() == 0) {
+                    continue;
+                }
+                for (auto it = first; it != last; ++it) {
+                    auto et = static_cast<EntityType>(*it);
+
+                    if (!_pools[i].Pool->Has(et)) {
+                        continue;
+                    }
+                    if (_pools[i].Signals) {
+                        _pools[i].EmitDeleted(*_pools[i].Signals, _pools[i].Mode, et);
+                        if (!_pools[i].Pool->Has(et)) {
+                            continue;
+                        }
+                    }
+                    OnRemove(_pools[i], et);
+                    _pools[i].Delete(_pools[i].Pool.get(), et);
+                }
+            }
+            for (auto it = first; it != last; ++it) {
+                auto et = static_cast<EntityType>(*it);
+
+                _entities.Erase(et);
+                _deleted_et.Insert(et);
+                if (_destroyed_signals) {
+                    details::EmitSignal<Destroyed<EntityType>>(*_destroyed_signals, _destroyed_mode, et);
+                }
+            }
+        }
+
         /**
          * @brief Destroys entities which own all specified components.
          * 
@@ -290,7 +592,9 @@ namespace indie::ecs
         template <typename Component, typename ...Components>
         void Destroy()
         {
-            for (auto et : _entities) {
+            // Backward, destroying an entity moves the last one at its place
+            for (auto i = _entities.Size(); i-- > 0;) {
+                auto et = *(_entities.Begin() + i);
                 if (Has<Component, Components...>(et)) {
                     Destroy(et);
                 }
@@ -314,7 +618,17 @@ namespace indie::ecs
         template <typename Component, typename ...Args>
         void Assign(const EntityType et, Args &&...args)
         {
-            TryAllocatePool<Component>()->Assign(et, std::forward<Args>(args)...);
+            auto pool = TryAllocatePool<Component>();
+
+            if (!pool->Has(et)) {
+                auto &data = _pools[PoolData::template GetPoolId<Component>()];
+
+                pool->Assign(et, std::forward<Args>(args)...);
+                OnAssign(data, et);
+                if (data.Signals) {
+                    data.EmitAssigned(*data.Signals, data.Mode, et);
+                }
+            }
         }
 
         /**
@@ -333,7 +647,12 @@ namespace indie::ecs
         template <typename Component, typename ...Args>
         void Replace(const EntityType et, Args &&...args)
         {
-            GetPool<Component>()->Replace(et, std::forward<Args>(args)...);
+            auto &data = _pools[PoolData::template GetPoolId<Component>()];
+
+            static_cast<PoolType<Component> *>(data.Pool.get())->Replace(et, std::forward<Args>(args)...);
+            if (data.Signals) {
+                data.EmitReplaced(*data.Signals, data.Mode, et);
+            }
         }
     
         /**
@@ -350,7 +669,19 @@ namespace indie::ecs
         template <typename Component, typename ...Args>
         void AssignOrReplace(const EntityType et, Args &&...args)
         {
-            TryAllocatePool<Component>()->AssignOrReplace(et, std::forward<Args>(args)...);
+            auto pool = TryAllocatePool<Component>();
+
+            if (pool->Has(et)) {
+                auto &data = _pools[PoolData::template GetPoolId<Component>()];
+
+                pool->Replace(et, std::forward<Args>(args)...);
+                if (data.Signals) {
+                    data.EmitReplaced(*data.Signals, data.Mode, et);
+                }
+            }
+            else {
+                Assign<Component>(et, std::forward<Args>(args)...);
+            }
         }
 
         /**
@@ -359,14 +690,27 @@ namespace indie::ecs
          * @warning
          * Using an invalid entity or removing a component 
          * not own by the entity is undefined behavior.
+         * Components already removed by immediate observers of the previous ones,
+         * or by the observers of their own deletion, are skipped.
          * 
          * @tparam Component Type of the component to remove.
          * @param et A valid entity.
          */
         template <typename Component, typename ...Components>
-        void Delete(const EntityType et) noexcept
+        void Delete(const EntityType et)
         {
-            GetPool<Component>()->Delete(et);
+            auto pool_id = PoolData::template GetPoolId<Component>();
+
+            if (_pools[pool_id].Signals && _pools[pool_id].Pool->Has(et)) {
+                _pools[pool_id].EmitDeleted(*_pools[pool_id].Signals, _pools[pool_id].Mode, et);
+            }
+            // Looked up again, immediate observers may allocate pools
+            auto &data = _pools[pool_id];
+
+            if (data.Pool->Has(et)) {
+                OnRemove(data, et);
+                static_cast<PoolType<Component> *>(data.Pool.get())->Delete(et);
+            }
             if constexpr (sizeof...(Components) >= 1) {
                 Delete<Components...>(et);
             }
@@ -381,8 +725,18 @@ namespace indie::ecs
          * @tparam Components Components stored by the pools to reset.
          */
         template <typename Component, typename ...Components>
-        void Reset() noexcept
+        void Reset()
         {
+            if (_pools[PoolData::template GetPoolId<Component>()].Signals) {
+                EmitDeletedAll(PoolData::template GetPoolId<Component>());
+            }
+
+            auto &pool = _pools[PoolData::template GetPoolId<Component>()];
+
+            pool.Churn += pool.Pool->Size();
+            for (auto query_id : pool.Queries) {
+                _queries[query_id]->Clear();
+            }
             GetPool<Component>()->Reset();
             if constexpr (sizeof...(Components) >= 1) {
                 Reset<Components...>();
@@ -392,12 +746,45 @@ namespace indie::ecs
         /**
          * @brief Destroy every entity and assiocated components.
          * 
+         * Each pool is cleared at once instead of destroying entities one by one,
+         * components are destroyed in one linear pass per pool.
+         * Entity identifiers start again from 0.
+         * 
+         * @param mode Whether the storage is kept for the next entities or freed.
          */
-        void Reset() noexcept
+        void Reset(ResetMode mode = ResetMode::KeepCapacity)
         {
-            for (auto &et : _entities) {
-                Destroy(et);
+            for (std::size_t i = 0; i < _pools.size(); ++i) {
+                if (_pools[i].Pool && _pools[i].Signals) {
+                    EmitDeletedAll(i);
+                }
+            }
+            if (_destroyed_signals) {
+                for (auto i = _entities.Size(); i-- > 0;) {
+                    details::EmitSignal<Destroyed<EntityType>>(*_destroyed_signals, _destroyed_mode, *(_entities.Begin() + i));
+                }
             }
+            for (auto &pool : _pools) {
+                if (pool.Pool) {
+                    pool.Churn += pool.Pool->Size();
+                    pool.Clear(pool.Pool.get(), mode);
+                }
+            }
+            for (auto &query : _queries) {
+                if (query) {
+                    query->Clear(mode);
+                }
+            }
+
+            if (mode == ResetMode::Release) {
+                _entities.Release();
+                _deleted_et.Release();
+            }
+            else {
+                _entities.Clear();
+                _deleted_et.Clear();
+            }
+            _next = 0;
         }
 
         /**
@@ -482,10 +869,34 @@ namespace indie::ecs
         template <typename ...Components, typename Func>
         void ForEach(Func &&func)
         {
-            auto filter = Get<Components...>();
-            for (auto et : _entities) {
-                if (filter.template Has<Components...>(et)) {
-                    func(et, filter.template Get<Components>(et)...);
+            if constexpr (sizeof...(Components) == 1) {
+                // A single pool already holds exactly the matching entities.
+                // Backward, removing a component of the current entity moves the last one at its place
+                auto pool = GetPool<Components...>();
+                if (pool) {
+                    for (auto i = pool->Size(); i-- > 0;) {
+                        if (i >= pool->Size()) {
+                            continue;
+                        }
+                        auto et = *(pool->Begin() + i);
+                        func(et, *pool->Get(et));
+                    }
+                }
+            }
+            else {
+                auto filter = Get<Components...>();
+                if (auto query = GetQuery<Components...>()) {
+                    // Backward, removing a component of the current entity moves the last one at its place
+                    for (auto i = query->Entities.Size(); i-- > 0;) {
+                        auto et = *(query->Entities.Begin() + i);
+                        func(et, filter.template Get<Components>(et)...);
+                    }
+                    return;
+                }
+                for (auto et : _entities) {
+                    if (filter.template Has<Components...>(et)) {
+                        func(et, filter.template Get<Components>(et)...);
+                    }
                 }
             }
         }
@@ -529,6 +940,9 @@ namespace indie::ecs
         /**
          * @brief Gets the number of valid entities which own all specified components.
          * 
+         * Constant time for a single component or a tracked query (see `Track`),
+         * otherwise scans the smallest pool involved.
+         * 
          * @tparam Components Types of the components that entities should own.
          * @return Valid entities number that match with the specified components.
          */
@@ -538,14 +952,167 @@ namespace indie::ecs
             if constexpr (sizeof...(Components) == 0) {
                 return _entities.Size();
             }
+            else if constexpr (sizeof...(Components) == 1) {
+                auto pool = GetPool<Components...>();
+                return pool ? pool->Size() : 0;
+            }
             else {
-                auto result = 0;
-                for (const auto &et : _entities) {
-                    if (Has<Components...>(et)) {
-                        result++;
-                    }
+                if (auto query = GetQuery<Components...>()) {
+                    return static_cast<SizeType>(query->Entities.Size());
                 }
-                return result;
+                return Count<Components...>();
+            }
+        }
+
+        /**
+         * @brief Tracks the entities matching a query.
+         * 
+         * The list of matching entities is updated on each `Assign`, `Delete` and `Destroy`,
+         * `Size` and `IsEmpty` become constant time for this exact signature
+         * and `ForEach` only visits matching entities.
+         * Tracking an already tracked query does nothing.
+         * 
+         * @warning
+         * Modifying pools directly (through `Storage`) bypasses tracking.
+         * 
+         * @tparam Components Types of the components of the query.
+         * @return The entities matching the query, valid as long as this registry lives.
+         */
+        template <typename Component, typename ...Components>
+        const QueryCache<EntityType> &Track()
+        {
+            auto query_id = QueryData::template GetQueryId<Component, Components...>();
+
+            if (query_id >= _queries.size()) {
+                _queries.resize(query_id + 1);
+            }
+            if (_queries[query_id]) {
+                return *_queries[query_id];
+            }
+
+            std::vector<BasePoolType *> pools{TryAllocatePool<Component>(), TryAllocatePool<Components>()...};
+            auto query = std::make_unique<QueryData>();
+
+            query->Pools = std::move(pools);
+            Collect<Component, Components...>(query->Entities);
+            _pools[PoolData::template GetPoolId<Component>()].Queries.push_back(query_id);
+            (_pools[PoolData::template GetPoolId<Components>()].Queries.push_back(query_id), ...);
+            _queries[query_id] = std::move(query);
+            return *_queries[query_id];
+        }
+
+        /**
+         * @brief Sends the lifecycle signals of components to an event manager.
+         * 
+         * Observers of the event manager receive `Assigned`, `Replaced` and `Deleted`
+         * for each given component type, and pools not connected cost a single branch.
+         * 
+         * Destroying an entity sends `Deleted` for each of its components, in pool order,
+         * before the component is removed: an immediate observer still reads it
+         * and sees the components of the next pools.
+         * Queued signals keep their order within a signal type only.
+         * 
+         * @warning
+         * Modifying pools directly (through `Storage`) sends no signal.
+         * Immediate observers must not assign components to an entity being destroyed.
+         * 
+         * @tparam Components Types of the components.
+         * @param events The event manager, must outlive the connection.
+         * @param mode Whether the signals are notified during the change or queued.
+         */
+        template <typename Component, typename ...Components>
+        void Connect(event::EventManager &events, SignalMode mode = SignalMode::Immediate)
+        {
+            TryAllocatePool<Component>();
+
+            auto &pool = _pools[PoolData::template GetPoolId<Component>()];
+
+            pool.Signals = &events;
+            pool.Mode = mode;
+            if constexpr (sizeof...(Components) >= 1) {
+                Connect<Components...>(events, mode);
+            }
+        }
+        /**
+         * @brief Stops sending the lifecycle signals of components.
+         * 
+         * @tparam Components Types of the components.
+         */
+        template <typename Component, typename ...Components>
+        void Disconnect() noexcept
+        {
+            auto pool_id = PoolData::template GetPoolId<Component>();
+
+            if (pool_id < _pools.size()) {
+                _pools[pool_id].Signals = nullptr;
+            }
+            if constexpr (sizeof...(Components) >= 1) {
+                Disconnect<Components...>();
+            }
+        }
+
+        /**
+         * @brief Sends `Destroyed` to an event manager each time an entity is destroyed,
+         * after the `Deleted` signals of its components.
+         * 
+         * @param events The event manager, must outlive the connection.
+         * @param mode Whether the signals are notified during the destruction or queued.
+         */
+        void ConnectDestroyed(event::EventManager &events, SignalMode mode = SignalMode::Immediate) noexcept
+        {
+            _destroyed_signals = &events;
+            _destroyed_mode = mode;
+        }
+        /**
+         * @brief Stops sending `Destroyed`.
+         * 
+         */
+        void DisconnectDestroyed() noexcept
+        {
+            _destroyed_signals = nullptr;
+        }
+
+        /**
+         * @brief Gets statistics of a components pool.
+         * 
+         * @tparam Component Type of the component stored by the pool.
+         * @return Statistics of the pool, zeroed if the pool does not exist.
+         */
+        template <typename Component>
+        PoolStats Stats() const noexcept
+        {
+            auto pool_id = PoolData::template GetPoolId<Component>();
+
+            if (pool_id < _pools.size() && _pools[pool_id].Pool) {
+                return MakeStats(_pools[pool_id]);
+            }
+            return PoolStats{pool_id, 0, 0, 0, 0};
+        }
+        /**
+         * @brief Gets statistics of every components pool.
+         * 
+         * @return Statistics of each existing pool.
+         */
+        std::vector<PoolStats> Stats() const
+        {
+            std::vector<PoolStats> stats;
+
+            for (const auto &pool : _pools) {
+                if (pool.Pool) {
+                    stats.push_back(MakeStats(pool));
+                }
+            }
+            return stats;
+        }
+
+        /**
+         * @brief Starts a new churn measurement window, usually once per frame.
+         * 
+         */
+        void ResetChurn() noexcept
+        {
+            for (auto &pool : _pools) {
+                pool.Churn = 0;
             }
         }
 
@@ -618,10 +1185,77 @@ namespace indie::ecs
             TryAllocatePool<Component>()->Reserve(count);
         }
 
+    private:
+        /**
+         * @brief Counts entities matching components by scanning the smallest pool.
+         * 
+         * @tparam Components Types of the components.
+         * @return Number of matching entities.
+         */
+        template <typename ...Components>
+        SizeType Count() const noexcept
+        {
+            const BasePoolType *pools[] = {GetPool<Components>()...};
+            const BasePoolType *smallest = nullptr;
+
+            for (auto pool : pools) {
+                if (!pool) {
+                    return 0;
+                }
+                if (!smallest || pool->Size() < smallest->Size()) {
+                    smallest = pool;
+                }
+            }
+
+            SizeType result{0};
+            for (auto et : *smallest) {
+                if (Has<Components...>(et)) {
+                    ++result;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * @brief Inserts entities matching components by scanning the smallest pool.
+         * 
+         * @tparam Components Types of the components.
+         * @param entities Set receiving the matching entities.
+         */
+        template <typename ...Components>
+        void Collect(details::SparseSet<EntityType> &entities) const
+        {
+            const BasePoolType *pools[] = {GetPool<Components>()...};
+            auto smallest = *std::min_element(std::begin(pools), std::end(pools), [](auto lhs, auto rhs) {
+                return lhs->Size() < rhs->Size();
+            });
+
+            for (auto et : *smallest) {
+                if (Has<Components...>(et)) {
+                    entities.Insert(et);
+                }
+            }
+        }
+
+        static PoolStats MakeStats(const PoolData &pool) noexcept
+        {
+            return PoolStats{pool.ID, pool.Pool->Size(), pool.Capacity(pool.Pool.get()), pool.Bytes(pool.Pool.get()), pool.Churn};
+        }
+
     private:
         details::SparseSet<EntityType> _entities;
         details::SparseSet<EntityType> _deleted_et;
 
+        /*! Next never used entity identifier */
+        EntityType _next{0};
+
+        /*! Pools indexed by their identifier */
         std::vector<PoolData> _pools;
+        /*! Tracked queries indexed by their identifier, null if not tracked */
+        std::vector<std::unique_ptr<QueryData>> _queries;
+
+        /*! Receives `Destroyed`, null if no one listens */
+        event::EventManager *_destroyed_signals{nullptr};
+        SignalMode _destroyed_mode{SignalMode::Immediate};
     };
 }
\ No newline at end of file
@@ -0,0 +1,330 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <new>
+#include <utility>
+#include <iterator>
+
+/*! Fills released frame memory with 0xDD and new allocations with 0xCD, enabled in debug builds */
+#ifndef INDIE_ECS_ARENA_POISON
+#ifdef NDEBUG
+#define INDIE_ECS_ARENA_POISON 0
+#else
+#define INDIE_ECS_ARENA_POISON 1
+#endif
+#endif
+
+namespace indie::ecs
+{
+    /**
+     * @brief Bump allocator whose memory is released all at once.
+     *
+     * Memory comes from chunks, a new one is allocated when the current one is full.
+     * On `Reset`, chunks are merged in a single one big enough for the whole previous frame,
+     * so a steady workload ends up with one chunk and no allocation at all.
+     *
+     * Deallocation does nothing, destructors of objects built in the arena are not called on `Reset`.
+     */
+    class FrameArena : public std::pmr::memory_resource
+    {
+    public:
+        /*! Byte written over released memory */
+        static constexpr unsigned char FreedByte = 0xDD;
+        /*! Byte written over new allocations */
+        static constexpr unsigned char AllocatedByte = 0xCD;
+
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<std::byte[]> Data;
+            std::size_t Size;
+        };
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity Initial capacity in bytes.
+         */
+        explicit FrameArena(std::size_t capacity = 64 * 1024)
+        {
+            AddChunk(std::max<std::size_t>(capacity, 1));
+        }
+
+        ~FrameArena() override = default;
+
+        FrameArena(FrameArena &other) = delete;
+        FrameArena(FrameArena &&other) = delete;
+        FrameArena &operator=(FrameArena &other) = delete;
+        FrameArena &operator=(FrameArena &&other) = delete;
+
+        /**
+         * @brief Releases every allocation at once.
+         *
+         */
+        void Reset()
+        {
+            _high_water = std::max(_high_water, _used);
+            if (_chunks.size() > 1) {
+                // Merge in one chunk able to hold the previous frame
+                auto capacity = Capacity();
+                _chunks.clear();
+                AddChunk(capacity);
+            }
+#if INDIE_ECS_ARENA_POISON
+            else {
+                std::memset(_chunks.front().Data.get(), FreedByte, _offset);
+            }
+#endif
+            _offset = 0;
+            _used = 0;
+        }
+
+        /**
+         * @brief Gets the number of bytes allocated since the last reset, padding included.
+         *
+         * @return The used bytes.
+         */
+        std::size_t Used() const noexcept
+        {
+            return _used;
+        }
+
+        /**
+         * @brief Gets the highest number of bytes used by a frame.
+         *
+         * @return The high-water mark.
+         */
+        std::size_t HighWater() const noexcept
+        {
+            return std::max(_high_water, _used);
+        }
+
+        /**
+         * @brief Gets the number of bytes owned by the arena.
+         *
+         * @return The capacity.
+         */
+        std::size_t Capacity() const noexcept
+        {
+            std::size_t capacity{0};
+
+            for (auto &chunk : _chunks) {
+                capacity += chunk.Size;
+            }
+            return capacity;
+        }
+
+        /**
+         * @brief Gets the number of chunks owned by the arena, 1 in steady state.
+         *
+         * @return The number of chunks.
+         */
+        std::size_t Chunks() const noexcept
+        {
+            return _chunks.size();
+        }
+
+    protected:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            auto &chunk = _chunks.back();
+            auto address = reinterpret_cast<std::uintptr_t>(chunk.Data.get()) + _offset;
+            auto padding = (alignment - address % alignment) % alignment;
+
+            if (_offset + padding + bytes > chunk.Size) {
+                AddChunk(std::max(chunk.Size * 2, bytes + alignment));
+                return do_allocate(bytes, alignment);
+            }
+
+            auto result = chunk.Data.get() + _offset + padding;
+            _offset += padding + bytes;
+            _used += padding + bytes;
+#if INDIE_ECS_ARENA_POISON
+            std::memset(result, AllocatedByte, bytes);
+#endif
+            return result;
+        }
+
+        void do_deallocate(void *, std::size_t, std::size_t) override
+        {}
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    private:
+        void AddChunk(std::size_t size)
+        {
+            // Left uninitialized, allocations are poisoned on demand
+            _chunks.push_back(Chunk{std::unique_ptr<std::byte[]>(new std::byte[size]), size});
+            _offset = 0;
+        }
+
+    private:
+        std::vector<Chunk> _chunks;
+        /*! Offset of the next allocation in the last chunk */
+        std::size_t _offset{0};
+        std::size_t _used{0};
+        std::size_t _high_water{0};
+    };
+
+    /**
+     * @brief Memory usage of a frame allocator.
+     *
+     */
+    struct FrameAllocatorStats
+    {
+        /*! Number of threads which allocated, one arena each */
+        std::size_t Arenas;
+        /*! Bytes used during the current frame, every arena included */
+        std::size_t Used;
+        /*! Highest number of bytes used by a single arena in a frame */
+        std::size_t HighWater;
+        /*! Bytes owned by every arena */
+        std::size_t Capacity;
+    };
+
+    /**
+     * @brief Per-frame memory with one bump arena per thread.
+     *
+     * Each thread allocating gets its own arena on first use, allocations never lock afterwards.
+     * Memory is valid until `Reset`, which the system manager calls at the end of each update.
+     *
+     * Example, inside a system:
+     * @code
+     * std::pmr::vector<Entity> neighbors{_frame->Resource()};
+     * @endcode
+     */
+    class FrameAllocator
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity Initial capacity in bytes of each arena.
+         */
+        explicit FrameAllocator(std::size_t capacity = 64 * 1024) :
+            _capacity(capacity), _id(GenerateId())
+        {}
+
+        ~FrameAllocator() = default;
+
+        FrameAllocator(FrameAllocator &other) = delete;
+        FrameAllocator(FrameAllocator &&other) = delete;
+        FrameAllocator &operator=(FrameAllocator &other) = delete;
+        FrameAllocator &operator=(FrameAllocator &&other) = delete;
+
+        /**
+         * @brief Gets the arena of the calling thread, usable by `std::pmr` containers.
+         *
+         * @return The memory resource of the calling thread.
+         */
+        FrameArena *Resource()
+        {
+            // Cached per thread, the identifier tells apart allocators reusing the same address
+            thread_local std::uint64_t cached_id{0};
+            thread_local FrameArena *cached{nullptr};
+
+            if (cached_id != _id) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                auto thread = std::this_thread::get_id();
+                auto it = std::find_if(_arenas.begin(), _arenas.end(), [thread](auto &arena) {
+                    return arena.first == thread;
+                });
+
+                if (it == _arenas.end()) {
+                    _arenas.emplace_back(thread, std::make_unique<FrameArena>(_capacity));
+                    it = std::prev(_arenas.end());
+                }
+                cached = it->second.get();
+                cached_id = _id;
+            }
+            return cached;
+        }
+
+        /**
+         * @brief Allocates memory valid until the end of the frame.
+         *
+         * @param bytes Size of the allocation.
+         * @param alignment Alignment of the allocation.
+         * @return The allocated memory.
+         */
+        void *Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t))
+        {
+            return Resource()->allocate(bytes, alignment);
+        }
+
+        /**
+         * @brief Allocates an uninitialized array valid until the end of the frame.
+         *
+         * @tparam T Type of the elements.
+         * @param count Number of elements.
+         * @return The array.
+         */
+        template <typename T>
+        T *Allocate(std::size_t count)
+        {
+            return static_cast<T *>(Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        /**
+         * @brief Releases the memory of every arena.
+         *
+         * @warning
+         * Must not be called while other threads allocate.
+         */
+        void Reset()
+        {
+            for (auto &arena : _arenas) {
+                arena.second->Reset();
+            }
+        }
+
+        /**
+         * @brief Gets memory usage, to size arenas from real workloads.
+         *
+         * @warning
+         * Must not be called while other threads allocate.
+         *
+         * @return The statistics.
+         */
+        FrameAllocatorStats Stats() const
+        {
+            FrameAllocatorStats stats{_arenas.size(), 0, 0, 0};
+
+            for (auto &arena : _arenas) {
+                stats.Used += arena.second->Used();
+                stats.HighWater = std::max(stats.HighWater, arena.second->HighWater());
+                stats.Capacity += arena.second->Capacity();
+            }
+            return stats;
+        }
+
+    private:
+        static std::uint64_t GenerateId() noexcept
+        {
+            static std::atomic<std::uint64_t> cur{1};
+
+            return cur++;
+        }
+
+    private:
+        std::size_t _capacity;
+        std::uint64_t _id;
+
+        std::mutex _mutex;
+        /*! Arena of each thread which allocated */
+        std::vector<std::pair<std::thread::id, std::unique_ptr<FrameArena>>> _arenas;
+    };
+}
\ No newline at end of file
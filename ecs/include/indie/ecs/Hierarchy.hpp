@@ -0,0 +1,362 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <limits>
+
+#include "./Entity.hpp"
+#include "./Pool.hpp"
+#include "./EntityManager.hpp"
+
+namespace indie::ecs
+{
+    /**
+     * @brief Component linking an entity to its parent, first child and siblings.
+     *
+     * Children of an entity form an intrusive doubly linked list,
+     * so no per-entity container is ever allocated.
+     *
+     * @tparam EntityType The type of the entity identifier.
+     */
+    template <typename EntityType = Entity>
+    struct Relationship
+    {
+        /*! Value of a link pointing to no entity */
+        static constexpr EntityType Null = std::numeric_limits<EntityType>::max();
+
+        EntityType Parent{Null};
+        EntityType FirstChild{Null};
+        EntityType PrevSibling{Null};
+        EntityType NextSibling{Null};
+
+        std::size_t Children{0};
+        std::size_t Depth{0};
+    };
+
+    /**
+     * @brief Maintains parent/child relationships between entities of a registry.
+     *
+     * Links are stored in the `Relationship` pool of the registry.
+     * Iterating through the hierarchy sorts this pool by depth first,
+     * so a parent is always visited before its children and propagating
+     * data from parents to children is a linear walk over contiguous memory.
+     *
+     * @warning
+     * Entities belonging to a hierarchy must be destroyed with `Hierarchy::Destroy`,
+     * destroying them from the registry leaves dangling links.
+     *
+     * @tparam EntityType The type of the entity identifier.
+     */
+    template <typename EntityType = Entity>
+    class Hierarchy
+    {
+    public:
+        using EntityManagerType = EntityManager<EntityType>;
+
+        using RelationshipType = Relationship<EntityType>;
+
+        using PoolType = Pool<RelationshipType, EntityType>;
+
+        static constexpr EntityType Null = RelationshipType::Null;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param em A valid entity manager
+         */
+        explicit Hierarchy(EntityManagerType &em) :
+            _em(em), _pool(em.template Storage<RelationshipType>())
+        {}
+        ~Hierarchy() = default;
+
+        Hierarchy(Hierarchy &other) = delete;
+        Hierarchy(Hierarchy &&other) = delete;
+        Hierarchy &operator=(Hierarchy &other) = delete;
+        Hierarchy &operator=(Hierarchy &&other) = delete;
+
+    public:
+        /**
+         * @brief Attaches an entity to a parent.
+         *
+         * If the child already has a parent, it is detached from it first.
+         * Depths of the whole child subtree are updated.
+         *
+         * @warning
+         * Attaching an entity to itself or to one of its descendants is undefined behavior.
+         *
+         * @param child A valid entity.
+         * @param parent A valid entity.
+         */
+        void Attach(const EntityType child, const EntityType parent)
+        {
+            // Both links must exist before taking references, assigning may reallocate the pool
+            Link(parent);
+            Link(child);
+            Unlink(child);
+
+            auto &p = *_pool.Get(parent);
+            auto &c = *_pool.Get(child);
+
+            c.Parent = parent;
+            c.NextSibling = p.FirstChild;
+            if (p.FirstChild != Null) {
+                _pool.Get(p.FirstChild)->PrevSibling = child;
+            }
+            p.FirstChild = child;
+            ++p.Children;
+
+            UpdateDepth(child, p.Depth + 1);
+        }
+
+        /**
+         * @brief Detaches an entity from its parent.
+         *
+         * The entity becomes the root of its subtree.
+         * Does nothing if the entity has no parent.
+         *
+         * @param child A valid entity.
+         */
+        void Detach(const EntityType child)
+        {
+            if (!_pool.Has(child) || _pool.Get(child)->Parent == Null) {
+                return;
+            }
+            Unlink(child);
+            UpdateDepth(child, 0);
+        }
+
+        /**
+         * @brief Gets the parent of an entity.
+         *
+         * @param et A valid entity.
+         * @return The parent, `Null` if the entity has no parent.
+         */
+        EntityType Parent(const EntityType et)
+        {
+            auto link = _pool.Get(et);
+            return link ? link->Parent : Null;
+        }
+
+        /**
+         * @brief Gets the depth of an entity, roots have a depth of 0.
+         *
+         * @param et A valid entity.
+         * @return The depth of the entity.
+         */
+        std::size_t Depth(const EntityType et)
+        {
+            auto link = _pool.Get(et);
+            return link ? link->Depth : 0;
+        }
+
+        /**
+         * @brief Gets the number of direct children of an entity.
+         *
+         * @param et A valid entity.
+         * @return The number of children.
+         */
+        std::size_t Children(const EntityType et)
+        {
+            auto link = _pool.Get(et);
+            return link ? link->Children : 0;
+        }
+
+        /**
+         * @brief Iterates through direct children of an entity.
+         *
+         * Example:
+         * @code
+         * {
+         *     hierarchy.ForEachChild(player, [](const auto child) {
+         *         do_stuff;
+         *     });
+         * }
+         * @endcode
+         *
+         * @tparam Func The type of the function to apply.
+         * @param parent A valid entity.
+         * @param func A valid function.
+         */
+        template <typename Func>
+        void ForEachChild(const EntityType parent, Func &&func)
+        {
+            auto link = _pool.Get(parent);
+
+            for (auto child = link ? link->FirstChild : Null; child != Null;) {
+                // Fetched before calling, the function may detach the child
+                auto next = _pool.Get(child)->NextSibling;
+                func(child);
+                child = next;
+            }
+        }
+
+        /**
+         * @brief Iterates through every entity of the hierarchy, parents before children.
+         *
+         * Entities are visited by increasing depth, in the storage order of the pool.
+         *
+         * Example:
+         * @code
+         * {
+         *     hierarchy.ForEach([&](const auto et, const auto &link) {
+         *         if (link.Parent != hierarchy.Null) {
+         *             world[et] = world[link.Parent] * local[et];
+         *         }
+         *     });
+         * }
+         * @endcode
+         *
+         * @warning
+         * Attaching, detaching or destroying entities during the iteration is undefined behavior.
+         *
+         * @tparam Func The type of the function to apply.
+         * @param func A valid function.
+         */
+        template <typename Func>
+        void ForEach(Func &&func)
+        {
+            Sort();
+            _pool.ForEach([&](const EntityType et, const RelationshipType &link) {
+                func(et, link);
+            });
+        }
+
+        /**
+         * @brief Sorts the relationship pool by depth.
+         *
+         * Does nothing if the pool is already sorted.
+         */
+        void Sort()
+        {
+            if (IsSorted()) {
+                return;
+            }
+            _pool.Sort([](const RelationshipType &lhs, const RelationshipType &rhs) {
+                return lhs.Depth < rhs.Depth;
+            });
+        }
+
+        /**
+         * @brief Destroys an entity and its whole subtree.
+         *
+         * The subtree is gathered first, then destroyed as a batch visiting each pool once,
+         * without repairing links between entities which are all going away.
+         *
+         * @param root A valid entity.
+         */
+        void Destroy(const EntityType root)
+        {
+            if (!_pool.Has(root)) {
+                _em.Destroy(root);
+                return;
+            }
+
+            Unlink(root);
+            CollectSubtree(root);
+            _em.DestroyBatch(_subtree.begin(), _subtree.end());
+        }
+
+    private:
+        /**
+         * @brief Assigns an empty relationship to an entity if it has none.
+         *
+         * @param et A valid entity.
+         */
+        void Link(const EntityType et)
+        {
+            if (!_pool.Has(et)) {
+                // Through the registry, so tracked queries and statistics stay accurate
+                _em.template Assign<RelationshipType>(et);
+            }
+        }
+
+        /**
+         * @brief Removes an entity from its parent children list.
+         *
+         * @param et An entity owning a relationship.
+         */
+        void Unlink(const EntityType et)
+        {
+            auto &c = *_pool.Get(et);
+
+            if (c.Parent == Null) {
+                return;
+            }
+
+            auto &p = *_pool.Get(c.Parent);
+
+            if (p.FirstChild == et) {
+                p.FirstChild = c.NextSibling;
+            }
+            if (c.PrevSibling != Null) {
+                _pool.Get(c.PrevSibling)->NextSibling = c.NextSibling;
+            }
+            if (c.NextSibling != Null) {
+                _pool.Get(c.NextSibling)->PrevSibling = c.PrevSibling;
+            }
+            --p.Children;
+
+            c.Parent = Null;
+            c.PrevSibling = Null;
+            c.NextSibling = Null;
+        }
+
+        /**
+         * @brief Gathers a subtree breadth-first, parents before children.
+         *
+         * @param root An entity owning a relationship.
+         */
+        void CollectSubtree(const EntityType root)
+        {
+            _subtree.clear();
+            _subtree.push_back(root);
+            for (std::size_t i = 0; i < _subtree.size(); ++i) {
+                for (auto child = _pool.Get(_subtree[i])->FirstChild; child != Null;) {
+                    _subtree.push_back(child);
+                    child = _pool.Get(child)->NextSibling;
+                }
+            }
+        }
+
+        /**
+         * @brief Sets the depth of an entity and updates its descendants accordingly.
+         *
+         * @param root An entity owning a relationship.
+         * @param depth New depth of the entity.
+         */
+        void UpdateDepth(const EntityType root, std::size_t depth)
+        {
+            CollectSubtree(root);
+            _pool.Get(root)->Depth = depth;
+            for (std::size_t i = 1; i < _subtree.size(); ++i) {
+                auto &link = *_pool.Get(_subtree[i]);
+                link.Depth = _pool.Get(link.Parent)->Depth + 1;
+            }
+        }
+
+        /**
+         * @brief Tells if the relationship pool is ordered by depth.
+         *
+         * Linear check, much cheaper than sorting an already sorted pool.
+         */
+        bool IsSorted()
+        {
+            std::size_t prev{0};
+            bool sorted{true};
+
+            _pool.ForEach([&](const EntityType, const RelationshipType &link) {
+                sorted = sorted && prev <= link.Depth;
+                prev = link.Depth;
+            });
+            return sorted;
+        }
+
+    private:
+        EntityManagerType &_em;
+
+        PoolType &_pool;
+
+        /*! Scratch buffer reused by subtree walks */
+        std::vector<EntityType> _subtree;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <exception>
+
+#include "./details/JobQueue.hpp"
+
+namespace indie::ecs
+{
+    /**
+     * @brief Number of unfinished jobs spawned against it, waited on with `JobSystem::Wait`.
+     *
+     */
+    class JobCounter
+    {
+    public:
+        JobCounter() = default;
+        ~JobCounter() = default;
+
+        JobCounter(JobCounter &other) = delete;
+        JobCounter(JobCounter &&other) = delete;
+        JobCounter &operator=(JobCounter &other) = delete;
+        JobCounter &operator=(JobCounter &&other) = delete;
+
+        /**
+         * @brief Tells if every job spawned against this counter is finished.
+         *
+         * @return True if no job is pending.
+         */
+        bool IsDone() const noexcept
+        {
+            return _count.load(std::memory_order_acquire) == 0;
+        }
+
+    private:
+        friend class JobSystem;
+
+        void Fail(std::exception_ptr error) noexcept
+        {
+            if (!_failed.exchange(true, std::memory_order_relaxed)) {
+                _error = std::move(error);
+            }
+        }
+
+        std::atomic<std::size_t> _count{0};
+        /*! Set by the first job which threw, its exception is published by the decrement of `_count` */
+        std::atomic<bool> _failed{false};
+        std::exception_ptr _error;
+    };
+
+    /**
+     * @brief Work-stealing job system with one worker thread per core.
+     *
+     * Each worker owns a queue: it runs its most recent jobs first
+     * and steals the oldest jobs of the other queues when its own is empty.
+     * Jobs spawned from other threads go to a shared queue.
+     *
+     * `Wait` never blocks the calling thread while jobs are pending: it runs jobs,
+     * preferably from its own queue, until the counter reaches zero.
+     * Jobs may spawn and wait on other jobs, nested waits run on the stack of the waiting job.
+     *
+     * Jobs are trivially copyable callables of at most `details::Job::Capacity` bytes,
+     * spawning never allocates once queues reached their peak size.
+     * An exception thrown by a job is caught on the thread running it and rethrown by `Wait`,
+     * the first one if several jobs of the counter throw.
+     */
+    class JobSystem
+    {
+    public:
+        /**
+         * @brief Constructor, starts the worker threads.
+         *
+         * @param workers Number of worker threads, threads calling `Wait` help them.
+         * 0 runs every job on the waiting thread.
+         */
+        explicit JobSystem(std::size_t workers = DefaultWorkers()) :
+            _queues(workers + 1)
+        {
+            for (auto &queue : _queues) {
+                queue = std::make_unique<details::JobQueue>();
+            }
+            for (std::size_t i = 0; i < workers; ++i) {
+                _threads.emplace_back([this, i] {
+                    Work(i);
+                });
+            }
+        }
+
+        /**
+         * @brief Destructor, stops and joins the worker threads.
+         *
+         * @warning
+         * Pending jobs are dropped, wait for them first.
+         */
+        ~JobSystem()
+        {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _stopping = true;
+            }
+            _wake.notify_all();
+            for (auto &thread : _threads) {
+                thread.join();
+            }
+        }
+
+        JobSystem(JobSystem &other) = delete;
+        JobSystem(JobSystem &&other) = delete;
+        JobSystem &operator=(JobSystem &other) = delete;
+        JobSystem &operator=(JobSystem &&other) = delete;
+
+        /**
+         * @brief Gets the number of worker threads.
+         *
+         * @return The number of worker threads.
+         */
+        std::size_t Workers() const noexcept
+        {
+            return _threads.size();
+        }
+
+        /**
+         * @brief Gets the default number of workers: one per core, the calling thread included.
+         *
+         * @return The number of workers.
+         */
+        static std::size_t DefaultWorkers() noexcept
+        {
+            auto cores = std::thread::hardware_concurrency();
+
+            return cores > 1 ? cores - 1 : 0;
+        }
+
+        /**
+         * @brief Queues a job.
+         *
+         * @tparam Func Type of the job, trivially copyable.
+         * @param counter Counter incremented now and decremented once the job is finished.
+         * @param func The job.
+         */
+        template <typename Func>
+        void Spawn(JobCounter &counter, Func &&func)
+        {
+            auto *target = &counter;
+            details::Job job{[target, func]() {
+                try {
+                    func();
+                }
+                catch (...) {
+                    target->Fail(std::current_exception());
+                }
+                target->_count.fetch_sub(1, std::memory_order_acq_rel);
+            }};
+
+            counter._count.fetch_add(1, std::memory_order_relaxed);
+            // Counted before being visible, so the pending count never underflows
+            _pending.fetch_add(1, std::memory_order_seq_cst);
+            _queues[LocalQueue()]->Push(job);
+            if (_sleeping.load(std::memory_order_seq_cst) > 0) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _wake.notify_one();
+            }
+        }
+
+        /**
+         * @brief Queues `count` jobs, each called with its index.
+         *
+         * @tparam Func Type of the job, trivially copyable.
+         * @param counter Counter incremented now and decremented once each job is finished.
+         * @param count Number of jobs.
+         * @param func The job.
+         */
+        template <typename Func>
+        void Spawn(JobCounter &counter, std::size_t count, Func &&func)
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                Spawn(counter, [func, i]() {
+                    func(i);
+                });
+            }
+        }
+
+        /**
+         * @brief Runs jobs until every job spawned against a counter is finished.
+         *
+         * Rethrows the first exception thrown by a job of the counter, the counter may then be reused.
+         *
+         * @param counter The counter.
+         */
+        void Wait(JobCounter &counter)
+        {
+            auto queue = LocalQueue();
+            details::Job job;
+
+            while (!counter.IsDone()) {
+                if (TakeJob(queue, job)) {
+                    job();
+                }
+                else {
+                    // The last jobs are running on other threads
+                    std::this_thread::yield();
+                }
+            }
+            if (counter._failed.load(std::memory_order_relaxed)) {
+                counter._failed.store(false, std::memory_order_relaxed);
+                std::rethrow_exception(std::exchange(counter._error, nullptr));
+            }
+        }
+
+    private:
+        /**
+         * @brief Gets the queue of the calling thread, the shared queue for foreign threads.
+         *
+         * @return Index of the queue.
+         */
+        std::size_t LocalQueue() const noexcept
+        {
+            return tl_owner == this ? tl_queue : _threads.size();
+        }
+
+        bool TakeJob(std::size_t queue, details::Job &job)
+        {
+            if (_pending.load(std::memory_order_relaxed) == 0) {
+                return false;
+            }
+            if (_queues[queue]->Pop(job)) {
+                _pending.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            for (std::size_t i = 1; i < _queues.size(); ++i) {
+                if (_queues[(queue + i) % _queues.size()]->Steal(job)) {
+                    _pending.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Work(std::size_t queue)
+        {
+            details::Job job;
+
+            tl_owner = this;
+            tl_queue = queue;
+            for (;;) {
+                if (TakeJob(queue, job)) {
+                    job();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{_mutex};
+                _sleeping.fetch_add(1, std::memory_order_seq_cst);
+                _wake.wait(lock, [this] {
+                    return _stopping || _pending.load(std::memory_order_seq_cst) > 0;
+                });
+                _sleeping.fetch_sub(1, std::memory_order_relaxed);
+                if (_stopping) {
+                    return;
+                }
+            }
+        }
+
+    private:
+        static inline thread_local const JobSystem *tl_owner{nullptr};
+        static inline thread_local std::size_t tl_queue{0};
+
+        /*! One queue per worker, then the shared queue */
+        std::vector<std::unique_ptr<details::JobQueue>> _queues;
+        std::vector<std::thread> _threads;
+
+        /*! Number of queued jobs not taken yet */
+        std::atomic<std::size_t> _pending{0};
+        std::atomic<std::size_t> _sleeping{0};
+
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        bool _stopping{false};
+    };
+}
\ No newline at end of file
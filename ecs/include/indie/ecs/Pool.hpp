@@ -3,27 +3,38 @@
 #include <set>
 #include <memory>
 #include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <utility>
 
 #include "./Entity.hpp"
 #include "./details/SparseSet.hpp"
+#include "./details/HashedSparseSet.hpp"
 
 namespace indie::ecs
 {
-    template <typename Component, typename EntityType = Entity>
-    class Pool : public details::SparseSet<EntityType>
+    /**
+     * @brief Stores components of a single type, indexed by entity.
+     * 
+     * @tparam Component Type of the components.
+     * @tparam EntityType Type of the entity identifier.
+     * @tparam SetType Type of the set used to index components, `details::SparseSet` by default.
+     */
+    template <typename Component, typename EntityType = Entity, typename SetType = details::SparseSet<EntityType>>
+    class Pool : public SetType
     {
     public:
-        using BaseType = typename details::SparseSet<EntityType>;
+        using BaseType = SetType;
         using SizeType = typename BaseType::SizeType;
 
     public:
         Pool() = default;
         ~Pool() = default;
 
-        Pool(const Pool<Component, EntityType> &other) = delete;
-        Pool(const Pool<Component, EntityType> &&other) = delete;
-        Pool &operator=(const Pool<Component, EntityType> &other) = delete;
-        Pool &operator=(const Pool<Component, EntityType> &&other) = delete;
+        Pool(const Pool &other) = delete;
+        Pool(const Pool &&other) = delete;
+        Pool &operator=(const Pool &other) = delete;
+        Pool &operator=(const Pool &&other) = delete;
 
         /**
          * @brief Allocates a new component and assignes it to an entity.
@@ -39,9 +50,6 @@ namespace indie::ecs
         Component &Assign(EntityType et, Args &&...args)
         {
             BaseType::Insert(et);
-            if (BaseType::IndexOf(et) >= Capacity()) {
-                Reserve(BaseType::IndexOf(et) + 1);
-            }
             return (_components.emplace_back(Component(std::forward<Args>(args)...)));
         }
 
@@ -90,6 +98,13 @@ namespace indie::ecs
          */
         void Delete(EntityType et)
         {
+            // Mirrors the swap-and-pop done by the set on its dense storage
+            auto index = BaseType::IndexOf(et);
+
+            if (index != _components.size() - 1) {
+                _components[index] = std::move(_components.back());
+            }
+            _components.pop_back();
             BaseType::Erase(et);
         }
 
@@ -136,6 +151,8 @@ namespace indie::ecs
         /**
          * @brief Deletes every assigned component.
          * 
+         * Components are destroyed in a single linear pass,
+         * storage capacity is kept for later assignments.
          */
         void Reset()
         {
@@ -143,6 +160,16 @@ namespace indie::ecs
             BaseType::Clear();
         }
 
+        /**
+         * @brief Deletes every assigned component and frees the storage.
+         * 
+         */
+        void Release()
+        {
+            std::vector<Component>().swap(_components);
+            BaseType::Release();
+        }
+
         /**
          * @brief Gets the number of allocated components.
          * 
@@ -163,6 +190,16 @@ namespace indie::ecs
             return _components.capacity();
         }
 
+        /**
+         * @brief Gets the memory allocated by this pool.
+         * 
+         * @return Allocated bytes, components and index included.
+         */
+        std::size_t Bytes() const noexcept
+        {
+            return BaseType::Bytes() + _components.capacity() * sizeof(Component);
+        }
+
         /**
          * @brief Increases storage space.
          * 
@@ -209,12 +246,85 @@ namespace indie::ecs
         void ForEach(Func &&func)
         {
             for (auto it = BaseType::Begin(); it != BaseType::End(); it++) {
-                auto component = _components[BaseType::IndexOf(*it)];
+                auto &component = _components[BaseType::IndexOf(*it)];
                 func(*it, component);
             }
         }
 
+        /**
+         * @brief Sorts components and their entities.
+         * 
+         * Iterating the pool after sorting visits components in the specified order,
+         * until the pool is modified again.
+         * 
+         * Example:
+         * @code
+         * {
+         *     pool.Sort([](const MyComponent &lhs, const MyComponent &rhs) {
+         *         return lhs.Value < rhs.Value;
+         *     });
+         * }
+         * @endcode
+         * 
+         * @tparam Compare Type of the comparison function.
+         * @param compare A strict weak ordering between two components.
+         */
+        template <typename Compare>
+        void Sort(Compare &&compare)
+        {
+            std::vector<SizeType> order(BaseType::Size());
+
+            for (SizeType i = 0; i < order.size(); ++i) {
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(), [&](SizeType lhs, SizeType rhs) {
+                return compare(std::as_const(_components[lhs]), std::as_const(_components[rhs]));
+            });
+
+            // Applies the permutation in place by walking its cycles
+            for (SizeType pos = 0; pos < order.size(); ++pos) {
+                auto curr = pos;
+                auto next = order[curr];
+
+                while (next != pos) {
+                    SwapAt(curr, next);
+                    order[curr] = curr;
+                    curr = next;
+                    next = order[curr];
+                }
+                order[curr] = curr;
+            }
+        }
+
+    private:
+        /**
+         * @brief Swaps two components and their entities by position.
+         * 
+         * @param lhs Position of the first component.
+         * @param rhs Position of the second component.
+         */
+        void SwapAt(SizeType lhs, SizeType rhs)
+        {
+            EntityType lhs_et = *(BaseType::Begin() + lhs);
+            EntityType rhs_et = *(BaseType::Begin() + rhs);
+
+            BaseType::Swap(lhs_et, rhs_et);
+            std::swap(_components[lhs], _components[rhs]);
+        }
+
     private:
         std::vector<Component> _components;
     };
+
+    /**
+     * @brief Pool indexed by a hashed sparse set.
+     * 
+     * Suited to sparse identifiers (network or database 64-bit identifiers)
+     * that would make a regular sparse set allocate too much memory.
+     * 
+     * @tparam Component Type of the components.
+     * @tparam KeyType Type of the identifier.
+     */
+    template <typename Component, typename KeyType = std::uint64_t>
+    using HashedPool = Pool<Component, KeyType, details::HashedSparseSet<KeyType>>;
 }
\ No newline at end of file
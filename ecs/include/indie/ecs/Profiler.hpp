@@ -0,0 +1,299 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <algorithm>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+namespace indie::ecs
+{
+    /**
+     * @brief Profiler policy of the system manager doing nothing.
+     *
+     * Every hook is empty and system updates are not timed, instrumentation is compiled out.
+     */
+    struct NullProfiler
+    {
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr bool Enabled = false;
+
+        template <typename TSystem>
+        void Register(std::size_t) noexcept
+        {}
+
+        void BeginFrame() noexcept
+        {}
+
+        void Record(std::size_t, Clock::time_point, Clock::time_point) noexcept
+        {}
+    };
+
+    /**
+     * @brief Timing statistics of a system over the rolling window.
+     *
+     * Durations are in nanoseconds.
+     */
+    struct SystemTiming
+    {
+        std::string Name;
+        std::size_t Samples;
+        std::uint64_t Min;
+        std::uint64_t Avg;
+        std::uint64_t P99;
+    };
+
+    /**
+     * @brief Profiler policy of the system manager timing every system update.
+     *
+     * Keeps the durations of the last updates of each system to compute rolling statistics,
+     * and can capture a window of frames to export as a Chrome trace
+     * (loadable in `chrome://tracing` or Perfetto).
+     *
+     * Each update of a system is a sample: a `FixedUpdate` system catching up runs,
+     * and is recorded, up to `Timestep::MaxSteps` times in a frame.
+     * Updates of a system never overlap, so its record is only written
+     * by the thread updating it and no lock is taken.
+     */
+    class SystemProfiler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr bool Enabled = true;
+
+    private:
+        /**
+         * @brief A captured system update.
+         *
+         */
+        struct Event
+        {
+            std::uint64_t Start;
+            std::uint64_t Duration;
+            std::size_t Thread;
+            std::size_t Frame;
+        };
+
+        struct SystemRecord
+        {
+            std::string Name;
+            /*! Ring buffer of the last durations */
+            std::vector<std::uint64_t> Durations;
+            std::size_t Next{0};
+            std::vector<Event> Captured;
+        };
+
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param window Number of updates of each system used by the rolling statistics.
+         */
+        explicit SystemProfiler(std::size_t window = 128) :
+            _window(std::max<std::size_t>(window, 1)), _origin(Clock::now())
+        {}
+
+        /**
+         * @brief Registers a system, called by the system manager when the system is added.
+         *
+         * @tparam TSystem Type of the system.
+         * @param id Identifier of the system.
+         */
+        template <typename TSystem>
+        void Register(std::size_t id)
+        {
+            if (id >= _records.size()) {
+                _records.resize(id + 1);
+            }
+            _records[id].Name = Demangle(typeid(TSystem).name());
+            _records[id].Durations.reserve(_window);
+        }
+
+        /**
+         * @brief Starts a frame, called by the system manager before updating any system.
+         *
+         */
+        void BeginFrame() noexcept
+        {
+            ++_frame;
+            _capturing = _remaining > 0;
+            if (_capturing) {
+                --_remaining;
+            }
+        }
+
+        /**
+         * @brief Records a system update, called by the system manager from the updating thread.
+         *
+         * @param id Identifier of the system.
+         * @param start Time at which the update started.
+         * @param stop Time at which the update finished.
+         */
+        void Record(std::size_t id, Clock::time_point start, Clock::time_point stop)
+        {
+            auto &record = _records[id];
+            auto duration = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+
+            if (record.Durations.size() < _window) {
+                record.Durations.push_back(duration);
+            }
+            else {
+                record.Durations[record.Next] = duration;
+            }
+            record.Next = (record.Next + 1) % _window;
+
+            if (_capturing) {
+                auto offset = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start - _origin).count());
+                record.Captured.push_back(Event{offset, duration, ThreadIndex(), _frame});
+            }
+        }
+
+        /**
+         * @brief Captures every system update of the next frames, discarding the previous capture.
+         *
+         * @warning
+         * Must not be called during an update.
+         *
+         * @param frames Number of frames to capture.
+         */
+        void Capture(std::size_t frames)
+        {
+            for (auto &record : _records) {
+                record.Captured.clear();
+            }
+            _remaining = frames;
+        }
+
+        /**
+         * @brief Gets the rolling statistics of every system updated at least once.
+         *
+         * @warning
+         * Must not be called during an update.
+         *
+         * @return The statistics, ordered by system identifier.
+         */
+        std::vector<SystemTiming> Timings() const
+        {
+            std::vector<SystemTiming> timings;
+            std::vector<std::uint64_t> sorted;
+
+            for (auto &record : _records) {
+                if (record.Durations.empty()) {
+                    continue;
+                }
+                sorted = record.Durations;
+                std::sort(sorted.begin(), sorted.end());
+
+                std::uint64_t total{0};
+                for (auto duration : sorted) {
+                    total += duration;
+                }
+                auto p99 = (sorted.size() * 99 + 99) / 100 - 1;
+                timings.push_back(SystemTiming{record.Name, sorted.size(), sorted.front(), total / sorted.size(), sorted[p99]});
+            }
+            return timings;
+        }
+
+        /**
+         * @brief Writes the captured frames as Chrome trace events JSON.
+         *
+         * @warning
+         * Must not be called during an update.
+         *
+         * @param os Output stream.
+         */
+        void WriteChromeTrace(std::ostream &os) const
+        {
+            bool first = true;
+
+            os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            for (auto &record : _records) {
+                for (auto &event : record.Captured) {
+                    os << (first ? "" : ",")
+                       << "\n{\"name\":\"" << Escape(record.Name) << "\",\"cat\":\"system\",\"ph\":\"X\""
+                       << ",\"ts\":" << event.Start / 1000 << '.' << Fraction(event.Start)
+                       << ",\"dur\":" << event.Duration / 1000 << '.' << Fraction(event.Duration)
+                       << ",\"pid\":0,\"tid\":" << event.Thread
+                       << ",\"args\":{\"frame\":" << event.Frame << "}}";
+                    first = false;
+                }
+            }
+            os << "\n]}";
+        }
+
+    private:
+        /**
+         * @brief Gets a small index identifying the calling thread.
+         *
+         * @return The thread index.
+         */
+        static std::size_t ThreadIndex() noexcept
+        {
+            static std::atomic<std::size_t> next{0};
+            thread_local std::size_t index{next++};
+
+            return index;
+        }
+
+        static std::string Demangle(const char *name)
+        {
+#if defined(__GNUG__)
+            int status{0};
+            char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+
+            if (status == 0 && demangled) {
+                std::string result{demangled};
+                std::free(demangled);
+                return result;
+            }
+#endif
+            return name;
+        }
+
+        static std::string Escape(const std::string &str)
+        {
+            std::string result;
+
+            for (auto c : str) {
+                if (c == '"' || c == '\\') {
+                    result += '\\';
+                }
+                result += c;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Formats the sub-microsecond part of a duration on three digits.
+         *
+         */
+        static std::string Fraction(std::uint64_t ns)
+        {
+            auto str = std::to_string(ns % 1000);
+
+            return std::string(3 - str.size(), '0') + str;
+        }
+
+    private:
+        std::size_t _window;
+        Clock::time_point _origin;
+
+        /*! Indexed by system identifier */
+        std::vector<SystemRecord> _records;
+
+        std::size_t _frame{0};
+        std::size_t _remaining{0};
+        bool _capturing{false};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,575 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+#include <indie/meta/Tuple.hpp>
+#include <indie/meta/TypeList.hpp>
+
+#include "./Entity.hpp"
+#include "./EntityManager.hpp"
+#include "./System.hpp"
+
+namespace indie::ecs
+{
+    /**
+     * @brief Maps a coordinate to a shard by splitting the map in vertical strips.
+     *
+     * Coordinates outside of [Min, Max) are clamped to the first or last strip.
+     */
+    struct StripPartition
+    {
+        float Min;
+        float Max;
+        std::size_t Count;
+
+        std::size_t operator()(float x) const noexcept
+        {
+            if (x <= Min) {
+                return 0;
+            }
+            auto strip = static_cast<std::size_t>((x - Min) * Count / (Max - Min));
+            return std::min(strip, Count - 1);
+        }
+    };
+
+    template <typename Components, typename EntityType = Entity>
+    class ShardedWorld;
+
+    /**
+     * @brief Partitions one logical world across several registries, each updated by its own thread.
+     *
+     * Every shard owns an `EntityManager`, a `SystemManager` and a worker thread.
+     * `Update` runs one tick of every shard in parallel and returns once all of them are done.
+     *
+     * Entities move between shards with `Shard::Migrate`: components listed in `Components`
+     * are moved into a message which the destination shard receives at the beginning of its next tick.
+     * Messages produced during a tick are double-buffered, so shards never lock to exchange them
+     * and the result does not depend on threads scheduling.
+     *
+     * Handles returned by the world encode the shard in their high bits, then a generation
+     * and the local entity: they are unique across shards, and a handle kept after its entity
+     * was destroyed or migrated never refers to the entity reusing the local identifier,
+     * `Alive` tells it apart. A migrated entity gets a new handle, reported by `Shard::Arrivals`.
+     * Entities must be created and destroyed through their shard for the generations to be kept.
+     *
+     * @tparam Components Types of the components transferred on migration.
+     * @tparam EntityType The type of the entity identifier.
+     */
+    template <typename ...Components, typename EntityType>
+    class ShardedWorld<meta::TypeList<Components...>, EntityType>
+    {
+    public:
+        /*! Alias for `EntityManager<EntityType>` */
+        using EntityManagerType = EntityManager<EntityType>;
+
+        /*! Alias for `SystemManager<EntityType>` */
+        using SystemManagerType = SystemManager<EntityType>;
+
+        /*! Globally unique entity handle */
+        using Handle = std::uint64_t;
+
+        /*! Alias for `std::size_t` */
+        using ShardId = std::size_t;
+
+        /*! Number of bits of a handle below the shard: the generation and the local entity */
+        static constexpr unsigned ShardShift = 48;
+
+        /*! Number of bits of a handle storing the local entity */
+        static constexpr unsigned GenerationShift = 32;
+
+    private:
+        /**
+         * @brief Entity travelling from a shard to another.
+         *
+         */
+        struct Migration
+        {
+            /*! Handle of the entity in the sending shard, not alive anymore */
+            Handle From;
+            meta::Tuple<std::optional<Components>...> Data;
+        };
+
+    public:
+        /**
+         * @brief Entity received from another shard, with its old and new handles.
+         *
+         */
+        struct Arrival
+        {
+            Handle From;
+            Handle To;
+        };
+
+        /**
+         * @brief A region of the world, updated by its own thread.
+         *
+         */
+        class Shard
+        {
+        public:
+            Shard(ShardedWorld &world, ShardId id) :
+                _world(world), _id(id), _outbox{std::vector<std::vector<Migration>>(world._count), std::vector<std::vector<Migration>>(world._count)}
+            {}
+            ~Shard() = default;
+
+            Shard(Shard &other) = delete;
+            Shard(Shard &&other) = delete;
+            Shard &operator=(Shard &other) = delete;
+            Shard &operator=(Shard &&other) = delete;
+
+            /**
+             * @brief Gets the identifier of this shard.
+             *
+             * @return The shard identifier.
+             */
+            ShardId Id() const noexcept
+            {
+                return _id;
+            }
+
+            /**
+             * @brief Gets the registry of this shard.
+             *
+             * @warning
+             * Must only be used from systems of this shard, or between two world updates.
+             *
+             * @return The registry.
+             */
+            EntityManagerType &Entities() noexcept
+            {
+                return _em;
+            }
+
+            /**
+             * @brief Gets the systems updated by this shard.
+             *
+             * @return The system manager.
+             */
+            SystemManagerType &Systems() noexcept
+            {
+                return _sm;
+            }
+
+            /**
+             * @brief Gets the global handle of an entity of this shard.
+             *
+             * @param et A valid entity of this shard.
+             * @return The global handle.
+             */
+            Handle HandleOf(const EntityType et) const noexcept
+            {
+                return (static_cast<Handle>(_id) << ShardShift) | (static_cast<Handle>(GenerationOf(et)) << GenerationShift) |
+                       static_cast<Handle>(et);
+            }
+
+            /**
+             * @brief Creates an entity in this shard.
+             *
+             * @warning
+             * Must only be called from systems of this shard, or between two world updates.
+             *
+             * @return The new entity.
+             */
+            EntityType Create()
+            {
+                return _em.Create();
+            }
+
+            /**
+             * @brief Destroys an entity of this shard, its handle is not alive anymore.
+             *
+             * @warning
+             * Must only be called from systems of this shard, or between two world updates.
+             *
+             * @param et A valid entity of this shard.
+             */
+            void Destroy(const EntityType et)
+            {
+                auto index = static_cast<std::size_t>(et);
+
+                if (index >= _generations.size()) {
+                    _generations.resize(index + 1, 0);
+                }
+                ++_generations[index];
+                _em.Destroy(et);
+            }
+
+            /**
+             * @brief Tells if a handle refers to a living entity of this shard.
+             *
+             * @param handle A global handle.
+             * @return False if the entity was destroyed or migrated, or belongs to another shard.
+             */
+            bool Alive(const Handle handle) const noexcept
+            {
+                auto et = LocalOf(handle);
+
+                return ShardOf(handle) == _id && _em.Exists(et) && HandleOf(et) == handle;
+            }
+
+            /**
+             * @brief Gets the entities received from other shards at the beginning of the current tick.
+             *
+             * Lets the systems of this shard, or the caller between two updates,
+             * update the handles they keep to the migrated entities.
+             *
+             * @return The old and new handle of each received entity.
+             */
+            const std::vector<Arrival> &Arrivals() const noexcept
+            {
+                return _arrivals;
+            }
+
+            /**
+             * @brief Moves an entity to another shard.
+             *
+             * The entity is destroyed immediately, transferred components are moved
+             * into a message and recreated by the destination at its next tick.
+             * The new handle of the entity is then listed by the `Arrivals` of the destination.
+             *
+             * @warning
+             * Must only be called from systems of this shard, or between two world updates.
+             *
+             * @param et A valid entity of this shard.
+             * @param destination Identifier of the destination shard.
+             */
+            void Migrate(const EntityType et, const ShardId destination)
+            {
+                if (destination == _id) {
+                    return;
+                }
+
+                auto &migration = _outbox[_world._generation & 1][destination].emplace_back();
+                migration.From = HandleOf(et);
+                (Extract<Components>(et, migration), ...);
+                Destroy(et);
+            }
+
+        private:
+            friend class ShardedWorld;
+
+            template <typename Component>
+            void Extract(const EntityType et, Migration &migration)
+            {
+                if (_em.template Has<Component>(et)) {
+                    migration.Data.template Get<std::optional<Component>>().emplace(std::move(*_em.template Get<Component>(et)));
+                }
+            }
+
+            template <typename Component>
+            void Insert(const EntityType et, Migration &migration)
+            {
+                auto &component = migration.Data.template Get<std::optional<Component>>();
+                if (component) {
+                    _em.template Assign<Component>(et, std::move(*component));
+                }
+            }
+
+            /**
+             * @brief Receives entities sent by other shards during the previous tick.
+             *
+             */
+            void Receive()
+            {
+                auto parity = (_world._generation - 1) & 1;
+
+                _arrivals.clear();
+                for (auto &source : _world._shards) {
+                    auto &box = source->_outbox[parity][_id];
+                    for (auto &migration : box) {
+                        auto et = Create();
+                        (Insert<Components>(et, migration), ...);
+                        _arrivals.push_back(Arrival{migration.From, HandleOf(et)});
+                    }
+                    // Keeps capacity for the next ticks
+                    box.clear();
+                }
+            }
+
+            void Tick()
+            {
+                Receive();
+                _sm.Update();
+            }
+
+            /**
+             * @brief Gets the generation of a local entity, bumped each time an entity with its identifier is destroyed.
+             *
+             */
+            std::uint16_t GenerationOf(const EntityType et) const noexcept
+            {
+                auto index = static_cast<std::size_t>(et);
+
+                return index < _generations.size() ? _generations[index] : 0;
+            }
+
+        private:
+            ShardedWorld &_world;
+            ShardId _id;
+
+            EntityManagerType _em;
+            SystemManagerType _sm{_em};
+
+            /*! Outgoing migrations, by tick parity then destination */
+            std::vector<std::vector<Migration>> _outbox[2];
+            std::vector<Arrival> _arrivals;
+
+            /*! Generation of each local identifier, wraps around after 65536 reuses */
+            std::vector<std::uint16_t> _generations;
+
+            std::thread _thread;
+        };
+
+    public:
+        /**
+         * @brief Constructor, starts one worker thread per shard.
+         *
+         * @param count Number of shards.
+         */
+        explicit ShardedWorld(std::size_t count) :
+            _count(count)
+        {
+            for (ShardId id = 0; id < _count; ++id) {
+                _shards.emplace_back(std::make_unique<Shard>(*this, id));
+            }
+            for (auto &shard : _shards) {
+                shard->_thread = std::thread([this, owner = shard.get()] {
+                    Work(*owner);
+                });
+            }
+        }
+
+        /**
+         * @brief Destructor, stops and joins every worker thread.
+         *
+         */
+        ~ShardedWorld()
+        {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _stopping = true;
+            }
+            _start.notify_all();
+            for (auto &shard : _shards) {
+                shard->_thread.join();
+            }
+        }
+
+        ShardedWorld(ShardedWorld &other) = delete;
+        ShardedWorld(ShardedWorld &&other) = delete;
+        ShardedWorld &operator=(ShardedWorld &other) = delete;
+        ShardedWorld &operator=(ShardedWorld &&other) = delete;
+
+    public:
+        /**
+         * @brief Runs one tick of every shard in parallel.
+         *
+         * Returns once every shard has finished its tick.
+         * If systems of some shards threw, the first exception caught is rethrown then,
+         * the other shards having completed their tick.
+         */
+        void Update()
+        {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _pending = _count;
+                ++_generation;
+            }
+            _start.notify_all();
+
+            std::unique_lock<std::mutex> lock{_mutex};
+            _done.wait(lock, [this] {
+                return _pending == 0;
+            });
+            if (_error) {
+                std::rethrow_exception(std::exchange(_error, nullptr));
+            }
+        }
+
+        /**
+         * @brief Gets a shard.
+         *
+         * @warning
+         * Using an invalid identifier is undefined behavior.
+         *
+         * @param id Identifier of the shard.
+         * @return The shard.
+         */
+        Shard &GetShard(const ShardId id) noexcept
+        {
+            return *_shards[id];
+        }
+
+        /**
+         * @brief Gets the number of shards.
+         *
+         * @return The number of shards.
+         */
+        std::size_t Shards() const noexcept
+        {
+            return _count;
+        }
+
+        /**
+         * @brief Iterates through each shard.
+         *
+         * @tparam Func The type of the function to apply.
+         * @param func A valid function.
+         */
+        template <typename Func>
+        void ForEachShard(Func &&func)
+        {
+            for (auto &shard : _shards) {
+                func(*shard);
+            }
+        }
+
+        /**
+         * @brief Creates a new entity in a shard.
+         *
+         * @warning
+         * Must only be called between two updates.
+         *
+         * @param id Identifier of the shard.
+         * @return The global handle of the entity.
+         */
+        Handle Create(const ShardId id)
+        {
+            auto &shard = GetShard(id);
+            return shard.HandleOf(shard.Create());
+        }
+
+        /**
+         * @brief Destroys an entity, does nothing if its handle is not alive.
+         *
+         * @warning
+         * Must only be called between two updates.
+         *
+         * @param handle A global handle.
+         */
+        void Destroy(const Handle handle)
+        {
+            if (Alive(handle)) {
+                GetShard(ShardOf(handle)).Destroy(LocalOf(handle));
+            }
+        }
+
+        /**
+         * @brief Tells if a handle refers to a living entity.
+         *
+         * @warning
+         * Must only be called between two updates.
+         *
+         * @param handle A global handle.
+         * @return False if the entity was destroyed or migrated since the handle was given.
+         */
+        bool Alive(const Handle handle) const noexcept
+        {
+            auto id = ShardOf(handle);
+
+            return id < _count && _shards[id]->Alive(handle);
+        }
+
+        /**
+         * @brief Gets the shard owning an entity.
+         *
+         * @param handle A global handle.
+         * @return Identifier of the shard.
+         */
+        static ShardId ShardOf(const Handle handle) noexcept
+        {
+            return static_cast<ShardId>(handle >> ShardShift);
+        }
+
+        /**
+         * @brief Gets the entity of its shard registry.
+         *
+         * @param handle A global handle.
+         * @return The local entity.
+         */
+        static EntityType LocalOf(const Handle handle) noexcept
+        {
+            return static_cast<EntityType>(handle & ((Handle{1} << GenerationShift) - 1));
+        }
+
+        /**
+         * @brief Gets the number of entities of every shard.
+         *
+         * @warning
+         * Must only be called between two updates.
+         *
+         * @return The number of entities.
+         */
+        std::size_t Size() const noexcept
+        {
+            std::size_t size{0};
+
+            for (auto &shard : _shards) {
+                size += shard->_em.Size();
+            }
+            return size;
+        }
+
+    private:
+        void Work(Shard &shard)
+        {
+            std::uint64_t seen{0};
+
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock{_mutex};
+                    _start.wait(lock, [&] {
+                        return _stopping || _generation != seen;
+                    });
+                    if (_stopping) {
+                        return;
+                    }
+                    seen = _generation;
+                }
+
+                std::exception_ptr error;
+                try {
+                    shard.Tick();
+                }
+                catch (...) {
+                    error = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock{_mutex};
+                if (error && !_error) {
+                    _error = std::move(error);
+                }
+                if (--_pending == 0) {
+                    _done.notify_one();
+                }
+            }
+        }
+
+    private:
+        std::size_t _count;
+
+        std::vector<std::unique_ptr<Shard>> _shards;
+
+        std::mutex _mutex;
+        std::condition_variable _start;
+        std::condition_variable _done;
+
+        /*! Number of ticks started, its parity selects the outgoing migrations buffer */
+        std::uint64_t _generation{0};
+        std::size_t _pending{0};
+        bool _stopping{false};
+
+        /*! First exception thrown by a shard during the current tick */
+        std::exception_ptr _error;
+    };
+}
\ No newline at end of file
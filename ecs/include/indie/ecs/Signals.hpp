@@ -0,0 +1,92 @@
+#pragma once
+
+#include <indie/event/EventManager.hpp>
+
+#include "./Entity.hpp"
+
+namespace indie::ecs
+{
+    /**
+     * @brief How lifecycle signals reach the observers of an event manager.
+     *
+     */
+    enum class SignalMode
+    {
+        /*! Notified during the change, observers may read the component */
+        Immediate,
+        /*! Queued, delivered by the next `Dispatch` of the event manager */
+        Queued
+    };
+
+    /**
+     * @brief Signal sent after a component is assigned to an entity.
+     *
+     * @tparam Component Type of the component.
+     * @tparam EntityType Type of the entity identifier.
+     */
+    template <typename Component, typename EntityType = Entity>
+    struct Assigned
+    {
+        EntityType Entity;
+    };
+
+    /**
+     * @brief Signal sent after a component of an entity is replaced.
+     *
+     * @tparam Component Type of the component.
+     * @tparam EntityType Type of the entity identifier.
+     */
+    template <typename Component, typename EntityType = Entity>
+    struct Replaced
+    {
+        EntityType Entity;
+    };
+
+    /**
+     * @brief Signal sent before a component is removed from an entity,
+     * by `Delete`, `Destroy` or `Reset`.
+     *
+     * @tparam Component Type of the component.
+     * @tparam EntityType Type of the entity identifier.
+     */
+    template <typename Component, typename EntityType = Entity>
+    struct Deleted
+    {
+        EntityType Entity;
+    };
+
+    /**
+     * @brief Signal sent once an entity is destroyed, after the removal of its components.
+     *
+     * @tparam EntityType Type of the entity identifier.
+     */
+    template <typename EntityType = Entity>
+    struct Destroyed
+    {
+        EntityType Entity;
+    };
+
+    namespace details
+    {
+        /**
+         * @brief Sends a lifecycle signal to an event manager.
+         *
+         * @tparam Signal Type of the signal.
+         * @tparam EntityType Type of the entity identifier.
+         * @param events The event manager.
+         * @param mode Whether the signal is notified or queued.
+         * @param et The entity.
+         */
+        template <typename Signal, typename EntityType>
+        inline void EmitSignal(event::EventManager &events, SignalMode mode, EntityType et)
+        {
+            if (mode == SignalMode::Queued) {
+                events.Enqueue<Signal>(Signal{et});
+            }
+            else {
+                Signal args{et};
+                events.Notify<Signal>(args);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include <indie/meta/TypeList.hpp>
+#include <indie/meta/Tuple.hpp>
+
+#include "System.hpp"
+
+namespace indie::ecs
+{
+    /**
+     * @brief Updates a set of systems known at compile time.
+     *
+     * Systems are held by value and each update expands to an inlined sequence of calls,
+     * phase by phase then in declaration order, without virtual dispatch.
+     * Activation works as with `SystemManager`, through flags packed in a bit set,
+     * and systems with a declared query are skipped while it matches no entity.
+     *
+     * Systems run one after the other on the calling thread, an update lasts exactly one fixed step.
+     * Systems declaring `Rate`, `Sliced` or `Deferrable` need a `SystemManager`, they are rejected at compile time.
+     *
+     * Example:
+     * @code
+     * indie::ecs::StaticSystemManager<Input, Movement, Collisions, Snapshot> sm{em};
+     * while (running) {
+     *     sm.Update();
+     * }
+     * @endcode
+     *
+     * @tparam Systems Types of the systems, default constructible and sharing the same entity type.
+     */
+    template <typename ...Systems>
+    class StaticSystemManager
+    {
+        static_assert(sizeof...(Systems) > 0, "StaticSystemManager needs at least one system");
+
+    public:
+        /*! Types of the systems */
+        using SystemList = meta::TypeList<Systems...>;
+
+        /*! Entity type of the first system */
+        using EntityType = typename std::tuple_element_t<0, std::tuple<Systems...>>::Traits::EntityType;
+
+        /*! Alias for `EntityManager<EntityType>` */
+        using EntityManagerType = EntityManager<EntityType>;
+
+        /*! Number of systems */
+        static constexpr std::size_t Size = sizeof...(Systems);
+
+        static_assert((std::is_base_of_v<BaseSystem<EntityType>, Systems> && ...), "Systems must derive from System with the same entity type");
+        static_assert(((Systems::Traits::RateOf == 0 && Systems::Traits::SlicesOf == 1 && !Systems::Traits::IsDeferrable) && ...),
+                      "StaticSystemManager runs every system at each update, Rate, Sliced and Deferrable need a SystemManager");
+
+    public:
+        /**
+         * @brief Constructor, default constructs every system.
+         *
+         * @param em A valid entity manager
+         * @param workers Number of worker threads of the job system given to the systems.
+         */
+        explicit StaticSystemManager(EntityManagerType &em, std::size_t workers = 0) :
+            _em(em), _jobs(workers)
+        {
+            _active.Reserve(Size);
+            Init(std::index_sequence_for<Systems...>{});
+        }
+
+        ~StaticSystemManager() = default;
+
+        StaticSystemManager(StaticSystemManager &other) = delete;
+        StaticSystemManager(StaticSystemManager &&other) = delete;
+        StaticSystemManager &operator=(StaticSystemManager &other) = delete;
+        StaticSystemManager &operator=(StaticSystemManager &&other) = delete;
+
+    public:
+        /**
+         * @brief Tells if a system is part of the set.
+         *
+         * @tparam TSystem Type of the system.
+         * @return true If the set holds the system
+         */
+        template <typename TSystem>
+        static constexpr bool Has() noexcept
+        {
+            return meta::TypeListHas<TSystem, SystemList>::value;
+        }
+
+        /**
+         * @brief Gets a system.
+         *
+         * @tparam TSystem Type of the system.
+         * @return The system.
+         */
+        template <typename TSystem>
+        TSystem &Get() noexcept
+        {
+            return _systems.template Get<TSystem>();
+        }
+
+        /**
+         * @brief Activate a system
+         *
+         * @tparam TSystem Type of the system you want to activate
+         */
+        template <typename TSystem>
+        void Activate() noexcept
+        {
+            _active.Set(IndexOf<TSystem>());
+        }
+
+        /**
+         * @brief Deactivate a system
+         *
+         * @tparam TSystem Type of the system you want to deactivate
+         */
+        template <typename TSystem>
+        void Deactivate() noexcept
+        {
+            _active.Reset(IndexOf<TSystem>());
+        }
+
+        /**
+         * @brief Tells if a system is active
+         *
+         * @tparam TSystem Type of the system
+         * @return true If the system is active
+         */
+        template <typename TSystem>
+        bool IsActive() const noexcept
+        {
+            return _active.Test(IndexOf<TSystem>());
+        }
+
+        /**
+         * @brief Update every active system
+         *
+         * Runs every phase once, `FixedUpdate` included.
+         */
+        void Update()
+        {
+            _em.ResetChurn();
+
+            ++_time.Frame;
+            _time.Delta = _timestep.Fixed;
+            _time.Fixed = _timestep.Fixed;
+
+            UpdatePhase<Phase::Input>(std::index_sequence_for<Systems...>{});
+            UpdatePhase<Phase::FixedUpdate>(std::index_sequence_for<Systems...>{});
+            ++_time.Tick;
+            UpdatePhase<Phase::Update>(std::index_sequence_for<Systems...>{});
+            UpdatePhase<Phase::PostUpdate>(std::index_sequence_for<Systems...>{});
+            UpdatePhase<Phase::Render>(std::index_sequence_for<Systems...>{});
+
+            _frame.Reset();
+        }
+
+        /**
+         * @brief Sets the timing configuration, only the fixed step is used.
+         *
+         * @param timestep Timing configuration.
+         */
+        void SetTimestep(const Timestep &timestep) noexcept
+        {
+            _timestep = timestep;
+        }
+
+        /**
+         * @brief Gets the timing of the last update.
+         *
+         * @return The frame timing.
+         */
+        const FrameTime &Time() const noexcept
+        {
+            return _time;
+        }
+
+        /**
+         * @brief Gets the job system given to the systems.
+         *
+         * @return The job system.
+         */
+        JobSystem &GetJobs() noexcept
+        {
+            return _jobs;
+        }
+
+        /**
+         * @brief Gets the allocator of the memory released at the end of each update.
+         *
+         * @return The frame allocator.
+         */
+        FrameAllocator &GetFrameAllocator() noexcept
+        {
+            return _frame;
+        }
+
+    private:
+        template <typename TSystem>
+        static constexpr std::size_t IndexOf() noexcept
+        {
+            static_assert(Has<TSystem>(), "TSystem is not part of the StaticSystemManager");
+
+            return meta::TupleIndex<TSystem, meta::Tuple<Systems...>>::Value;
+        }
+
+        template <std::size_t ...Indices>
+        void Init(std::index_sequence<Indices...>)
+        {
+            (InitSystem<Indices>(), ...);
+        }
+
+        template <std::size_t Index>
+        void InitSystem()
+        {
+            using TSystem = std::tuple_element_t<Index, std::tuple<Systems...>>;
+
+            _queries[Index] = TrackQuery(typename TSystem::Traits::QueryList{});
+            _seen[Index] = ~std::uint64_t{0};
+            std::get<Index>(_systems).__init(&_em, &_time, _queries[Index], &_jobs, &_frame, &_active, Index);
+        }
+
+        template <Phase P, std::size_t ...Indices>
+        void UpdatePhase(std::index_sequence<Indices...>)
+        {
+            (UpdateSystem<P, Indices>(), ...);
+        }
+
+        template <Phase P, std::size_t Index>
+        void UpdateSystem()
+        {
+            using TSystem = std::tuple_element_t<Index, std::tuple<Systems...>>;
+            using Traits = typename TSystem::Traits;
+
+            if constexpr (Traits::PhaseOf == P) {
+                if (!_active.Test(Index)) {
+                    return;
+                }
+                if constexpr (Traits::QueryList::Size::value > 0) {
+                    auto query = _queries[Index];
+                    if (query->Entities.Size() == 0 || (Traits::SkipsUnchanged && query->Version == _seen[Index])) {
+                        return;
+                    }
+                    _seen[Index] = query->Version;
+                }
+                // Qualified call, resolved at compile time
+                std::get<Index>(_systems).TSystem::Update();
+            }
+        }
+
+        const QueryCache<EntityType> *TrackQuery(meta::TypeList<>) noexcept
+        {
+            return nullptr;
+        }
+
+        template <typename ...Components>
+        const QueryCache<EntityType> *TrackQuery(meta::TypeList<Components...>)
+        {
+            return &_em.template Track<Components...>();
+        }
+
+    private:
+        EntityManagerType &_em;
+
+        JobSystem _jobs;
+        FrameAllocator _frame;
+
+        Timestep _timestep;
+        FrameTime _time;
+
+        /*! Active flag of each system, indexed by position in `Systems` */
+        details::BitSet _active;
+        const QueryCache<EntityType> *_queries[Size]{};
+        /*! Version of the query at the last update of each system */
+        std::uint64_t _seen[Size]{};
+
+        meta::Tuple<Systems...> _systems;
+    };
+}
\ No newline at end of file
@@ -1,31 +1,56 @@
 #pragma once
 
 #include <memory>
-#include <map>
+#include <vector>
 #include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <numeric>
+#include <limits>
+#include <cmath>
 
 #include "EntityManager.hpp"
+#include "SystemAccess.hpp"
+#include "Profiler.hpp"
+#include "Timestep.hpp"
+#include "JobSystem.hpp"
+#include "FrameAllocator.hpp"
+#include "details/BitSet.hpp"
 
 namespace indie::ecs
 {
+    /**
+     * @brief Polymorphic base of every system, updated by a `SystemManager`.
+     *
+     * Systems should derive from `System` rather than from this class directly.
+     *
+     * @tparam EntityType The type of the entity identifier.
+     */
     template <typename EntityType = Entity>
-    class System
+    class BaseSystem
     {
     public:
         using EntityManagerType = EntityManager<EntityType>;
 
+        /*! Access declarations, none by default */
+        using Traits = details::SystemTraits<EntityType>;
+
     public:
         /**
          * @brief Default constructor.
          *
          */
-        System() = default;
+        BaseSystem() = default;
 
         /**
          * @brief Destructor.
          *
          */
-        virtual ~System() = default;
+        virtual ~BaseSystem() = default;
 
         /**
          * @brief This method is to be called each time the system manager instance is updated.
@@ -33,6 +58,24 @@ namespace indie::ecs
          */
         virtual void Update() = 0;
 
+        /**
+         * @brief Called instead of `Update` for a system declared `Deferrable`, given the time left in the frame budget.
+         *
+         * A system with a lot of work may do part of it and return false, it is then resumed
+         * at the next frames until it returns true. Progress must be made even with a null budget.
+         * Calls `Update()` by default.
+         *
+         * @param budget Time left before the frame exceeds its budget, maximal if there is no budget.
+         * @return true If the work is finished
+         * @return false If the system must be resumed at the next frame
+         */
+        virtual bool Resume(std::chrono::nanoseconds budget)
+        {
+            static_cast<void>(budget);
+            Update();
+            return true;
+        }
+
         /**
          * @brief Activate the current system instance.
          *
@@ -42,7 +85,12 @@ namespace indie::ecs
          */
         void Activate() noexcept
         {
-            _is_active = true;
+            if (_active) {
+                _active->Set(_id);
+            }
+            else {
+                _is_active = true;
+            }
         }
 
         /**
@@ -54,7 +102,12 @@ namespace indie::ecs
          */
         void Deactivate() noexcept
         {
-            _is_active = false;
+            if (_active) {
+                _active->Reset(_id);
+            }
+            else {
+                _is_active = false;
+            }
         }
 
         /**
@@ -68,7 +121,21 @@ namespace indie::ecs
          */
         bool IsActive() const noexcept
         {
-            return _is_active;
+            return _active ? _active->Test(_id) : _is_active;
+        }
+
+        /**
+         * @brief This method exists to be called by the system manager instance before each update of a system declaring `Sliced`
+         *
+         * Never throws
+         *
+         * @param slice Index of the range to update
+         * @param slices Number of ranges
+         */
+        void __slice(std::size_t slice, std::size_t slices) noexcept
+        {
+            _slice = slice;
+            _slices = slices;
         }
 
         /**
@@ -77,45 +144,266 @@ namespace indie::ecs
          * Never throws
          *
          * @param em Entity manager instance pointer hold by the SystemManager
+         * @param time Timing of the current frame hold by the SystemManager
+         * @param query Entities matching the declared query, null if none is declared
+         * @param jobs Job system hold by the SystemManager
+         * @param frame Frame allocator hold by the SystemManager
+         * @param active Active flags of the SystemManager, which takes over the flag of this system
+         * @param id Identifier of the system, index of its flag
          */
-        void __init(EntityManagerType *em) noexcept
+        void __init(EntityManagerType *em, const FrameTime *time, const QueryCache<EntityType> *query, JobSystem *jobs, FrameAllocator *frame,
+                    details::BitSet *active, std::size_t id) noexcept
         {
             _em = em;
+            _time = time;
+            _query = query;
+            _jobs = jobs;
+            _frame = frame;
+
+            _id = id;
+            _active = active;
+            if (_is_active) {
+                _active->Set(_id);
+            }
+            else {
+                _active->Reset(_id);
+            }
         }
 
     protected:
         EntityManagerType *_em;
 
+        /*! Timing of the frame being updated */
+        const FrameTime *_time;
+
+        /**
+         * Entities matching the query declared with `Query`, null if none is declared.
+         *
+         * @warning
+         * Assigning or removing components of the query while iterating it moves entities,
+         * iterate backward in that case.
+         */
+        const QueryCache<EntityType> *_query;
+
+        /**
+         * Job system running the systems, `Update` may spawn jobs and wait on them:
+         * @code
+         * indie::ecs::JobCounter counter;
+         * _jobs->Spawn(counter, batches, [this](std::size_t i) { ... });
+         * _jobs->Wait(counter);
+         * @endcode
+         */
+        JobSystem *_jobs;
+
+        /**
+         * Memory released at the end of the frame, for temporary containers:
+         * @code
+         * std::pmr::vector<Entity> neighbors{_frame->Resource()};
+         * @endcode
+         */
+        FrameAllocator *_frame;
+
+        /**
+         * @brief Gets the range to update at this run, for systems declaring `Sliced`.
+         *
+         * Ranges split `count` elements in equal parts, used round-robin:
+         * @code
+         * auto [begin, end] = SliceRange(_query->Entities.Size());
+         * for (auto i = begin; i < end; ++i) { ... }
+         * @endcode
+         *
+         * @warning
+         * Entities entering or leaving the query between runs move, they may be skipped or updated twice in a round.
+         *
+         * @param count Number of elements to split.
+         * @return The indices of the first element and past the last element of the range.
+         */
+        std::pair<std::size_t, std::size_t> SliceRange(std::size_t count) const noexcept
+        {
+            return {count * _slice / _slices, count * (_slice + 1) / _slices};
+        }
+
     private:
+        /*! Used until the system is registered */
         bool _is_active{true};
+
+        /*! Flags packed by the system manager, so its update loop does not touch inactive systems */
+        details::BitSet *_active{nullptr};
+        std::size_t _id{0};
+
+        std::size_t _slice{0};
+        std::size_t _slices{1};
     };
 
-    template <typename EntityType = Entity>
+    /**
+     * @brief Base class of user systems.
+     *
+     * Template arguments are an optional entity type followed by access declarations:
+     * @code
+     * class Movement : public indie::ecs::System<indie::ecs::Reads<Velocity>, indie::ecs::Writes<Position>>
+     * {
+     *     ...
+     * };
+     * @endcode
+     *
+     * Systems whose declarations do not conflict may be updated concurrently by the system manager.
+     * A system without any declaration, or declaring `Structural`, is updated alone.
+     * `InPhase` selects the phase of the frame in which the system is updated.
+     * `Deferrable` systems may be postponed or time-sliced when the frame runs out of budget.
+     *
+     * @tparam Args Entity type and access declarations (`Reads`, `Writes`, `Structural`, `InPhase`, `Query`, `SkipUnchanged`, `Deferrable`).
+     */
+    template <typename ...Args>
+    class System : public BaseSystem<typename details::SystemTraits<Args...>::EntityType>
+    {
+    public:
+        using Traits = details::SystemTraits<Args...>;
+    };
+
+    /**
+     * @brief Counters of the work postponed by the frame budget.
+     *
+     */
+    struct DeferralStats
+    {
+        /*! Updates of deferrable systems postponed because the budget was spent */
+        std::uint64_t Deferred{0};
+        /*! Updates which returned unfinished and were resumed at the next frame */
+        std::uint64_t Sliced{0};
+        /*! Updates run over budget because the system reached `Timestep::MaxDeferrals` */
+        std::uint64_t Forced{0};
+        /*! Frames which took longer than the budget */
+        std::uint64_t OverBudget{0};
+        /*! Deferrable systems currently postponed or unfinished */
+        std::size_t Pending{0};
+    };
+
+    /**
+     * @brief Registers and updates systems.
+     *
+     * @tparam EntityType The type of the entity identifier.
+     * @tparam Profiler Instrumentation policy, `SystemProfiler` times every system update,
+     * `NullProfiler` compiles instrumentation out.
+     */
+    template <typename EntityType = Entity, typename Profiler = NullProfiler>
     class SystemManager
     {
     public:
         /*! Alias for `EntityManager<EntityType>` */
         using EntityManagerType = EntityManager<EntityType>;
 
-        /*! Alias for `System<EntityType>` */
-        using SystemType = System<EntityType>;
+        /*! Alias for `BaseSystem<EntityType>` */
+        using SystemType = BaseSystem<EntityType>;
 
         /*! Alias for `std::size_t` */
         using SystemId = std::size_t;
 
-        /*! Alias for `std::shared_ptr<SystemType>` */
-        using SystemPtr = std::shared_ptr<SystemType>;
+        /*! Alias for `std::size_t` */
+        using ComponentId = std::size_t;
+
+    private:
+        /**
+         * @brief Components accessed by a system and its place in the schedule.
+         *
+         */
+        struct AccessInfo
+        {
+            std::vector<ComponentId> Reads;
+            std::vector<ComponentId> Writes;
+            /*! Undeclared or structural systems never run concurrently */
+            bool Exclusive{true};
+            Phase PhaseOf{Phase::Update};
+            std::size_t Stage{0};
+
+            /*! Declared query, null if none */
+            const QueryCache<EntityType> *Query{nullptr};
+            bool SkipUnchanged{false};
+            /*! Version of the query at the last update of the system */
+            std::uint64_t Seen{~std::uint64_t{0}};
+
+            bool Deferrable{false};
+            int Priority{0};
+            /*! The last update returned unfinished */
+            bool Unfinished{false};
+            /*! Number of frames in a row the system was postponed */
+            std::size_t Deferrals{0};
+
+            /*! Updates per second, 0 to run at every run of the phase */
+            unsigned Rate{0};
+            /*! The system runs at the runs of its phase whose index modulo `Period` is `Offset` */
+            std::size_t Period{1};
+            std::size_t Offset{0};
+            std::size_t Slices{1};
+            /*! Number of updates of the system */
+            std::uint64_t Runs{0};
+
+            /**
+             * @brief Tells if the system has nothing to do according to its query.
+             *
+             * @return True if the system can be skipped.
+             */
+            bool IsIdle() const noexcept
+            {
+                if (!Query) {
+                    return false;
+                }
+                // A round of slices is not interrupted
+                return Query->Entities.Size() == 0 || (SkipUnchanged && Query->Version == Seen && Runs % Slices == 0);
+            }
+
+            /**
+             * @brief Tells if two systems must not run concurrently.
+             *
+             * @param other Access of another system.
+             * @return True if the systems conflict.
+             */
+            bool Conflicts(const AccessInfo &other) const noexcept
+            {
+                return Exclusive || other.Exclusive ||
+                       Intersects(Writes, other.Writes) ||
+                       Intersects(Writes, other.Reads) ||
+                       Intersects(Reads, other.Writes);
+            }
+
+        private:
+            static bool Intersects(const std::vector<ComponentId> &lhs, const std::vector<ComponentId> &rhs) noexcept
+            {
+                return std::any_of(lhs.begin(), lhs.end(), [&](ComponentId id) {
+                    return std::find(rhs.begin(), rhs.end(), id) != rhs.end();
+                });
+            }
+        };
+
+        /**
+         * @brief A registered system, indexed by system identifier.
+         *
+         */
+        struct Slot
+        {
+            /*! Null if the system is not registered */
+            std::unique_ptr<SystemType> System;
+            AccessInfo Access;
+        };
 
-        /*! Alias for `std::map<SystemId, SystemPtr>` */
-        using SystemMap = std::map<SystemId, SystemPtr>;
+        /**
+         * @brief Range of the schedule whose systems may run concurrently.
+         *
+         */
+        struct Stage
+        {
+            std::size_t Begin;
+            std::size_t End;
+        };
 
     public:
         /**
          * @brief Constructor
          * @param em A valid entity manager
+         * @param workers Number of worker threads used to update non-conflicting systems and run their jobs,
+         * 0 updates every system and runs every job on the calling thread.
          */
-        explicit SystemManager(EntityManagerType &em) :
-            _em(em)
+        explicit SystemManager(EntityManagerType &em, std::size_t workers = 0) :
+            _em(em), _jobs(workers)
         {}
 
         /**
@@ -128,30 +416,55 @@ namespace indie::ecs
         /**
          * @brief Construct a new system and register it into the current SystemManager instance
          *
+         * The manager owns the system until it is removed or the manager is destroyed.
+         * If a system of the same type is already registered, nothing is constructed.
+         *
+         * May be called during an update by a system updated alone (undeclared or `Structural`),
+         * the new system is scheduled from the next phase.
+         *
          * @tparam TSystem Type of the system you want to activate
          * @tparam Args Types of the arguments to construct the system
          * @param args Arguments to pass to TSystem constructor
-         * @return std::shared_ptr<TSystem> Return a pointer to the newly constructed TSystem
+         * @return TSystem* Return a pointer to the registered TSystem, valid until it is removed
          */
         template <typename TSystem, typename ...Args>
-        std::shared_ptr<TSystem> Add(Args &&...args)
+        TSystem *Add(Args &&...args)
         {
             IsValidSystem<TSystem>();
 
-            auto system = std::make_shared<TSystem>(std::forward<Args>(args)...);
             auto id = GetSystemId<TSystem>();
+            if (id >= _slots.size()) {
+                _slots.resize(id + 1);
+                _active.Reserve(id + 1);
+            }
+
+            auto &slot = _slots[id];
+            if (slot.System) {
+                return static_cast<TSystem *>(slot.System.get());
+            }
 
-            system->__init(&_em);
+            auto system = std::make_unique<TSystem>(std::forward<Args>(args)...);
+            auto result = system.get();
 
-            _systems.emplace(id, system);
+            slot.Access = MakeAccess<typename TSystem::Traits>();
+            slot.Access.Query = TrackQuery(typename TSystem::Traits::QueryList{});
+            system->__init(&_em, &_time, slot.Access.Query, &_jobs, &_frame, &_active, id);
+            slot.System = std::move(system);
 
-            return system;
+            _profiler.template Register<TSystem>(id);
+            _dirty = true;
+
+            return result;
         }
 
 
         /**
          * @brief Remove a registered system
          *
+         * May be called during an update by a system updated alone (undeclared or `Structural`),
+         * the removed system is not updated anymore and is destroyed at the end of the frame,
+         * a system may thus remove itself.
+         *
          * @tparam TSystem Type of the system you want to remove
          */
         template <typename TSystem>
@@ -159,9 +472,20 @@ namespace indie::ecs
         {
             IsValidSystem<TSystem>();
 
-            if (Has<TSystem>()) {
-                _systems[GetSystemId<TSystem>()].reset();
+            if (!Has<TSystem>()) {
+                return;
+            }
+
+            auto id = GetSystemId<TSystem>();
+            auto &slot = _slots[id];
+
+            _active.Reset(id);
+            if (_updating) {
+                _removed.push_back(std::move(slot.System));
             }
+            slot.System.reset();
+            slot.Access = AccessInfo{};
+            _dirty = true;
         }
 
         /**
@@ -175,7 +499,7 @@ namespace indie::ecs
             IsValidSystem<TSystem>();
 
             if (Has<TSystem>()) {
-                _systems[GetSystemId<TSystem>()]->Activate();
+                _active.Set(GetSystemId<TSystem>());
             }
         }
 
@@ -190,10 +514,26 @@ namespace indie::ecs
             IsValidSystem<TSystem>();
 
             if (Has<TSystem>()) {
-                _systems[GetSystemId<TSystem>()]->Deactivate();
+                _active.Reset(GetSystemId<TSystem>());
             }
         }
 
+        /**
+         * @brief Gets a registered system
+         *
+         * Never throws
+         * @tparam TSystem Type of the system
+         * @return TSystem* The system, null if it is not registered
+         */
+        template <typename TSystem>
+        TSystem *Get() const noexcept
+        {
+            IsValidSystem<TSystem>();
+
+            auto id = GetSystemId<TSystem>();
+            return id < _slots.size() ? static_cast<TSystem *>(_slots[id].System.get()) : nullptr;
+        }
+
         /**
          * @brief Check if the current SystemManager instance holds a specific system
          * Do not distort the current instance
@@ -205,30 +545,577 @@ namespace indie::ecs
         template <typename TSystem>
         bool Has() const noexcept
         {
-            IsValidSystem<TSystem>();
-
-            if (_systems[GetSystemId<TSystem>()]) {
-                return true;
-            }
-            return false;
+            return Get<TSystem>() != nullptr;
         }
 
         /**
          * @brief Update every registered systems
          *
+         * Runs a frame lasting exactly one fixed step:
+         * every phase, including `FixedUpdate`, is run once.
          */
         void Update()
         {
-            for (auto &system : _systems)
-            {
-                if (system.second->IsActive())
-                {
-                    system.second->Update();
-                }
+            Update(_timestep.Fixed);
+        }
+
+        /**
+         * @brief Runs a frame after some wall-clock time elapsed.
+         *
+         * The elapsed time is added to the accumulator, `FixedUpdate` is run once per whole fixed step
+         * it contains, at most `Timestep::MaxSteps` times, the lag beyond is dropped.
+         * Other phases are run once, `FrameTime::Alpha` tells render systems how far
+         * the frame is between the last fixed step and the next one.
+         *
+         * Starts a new churn window of the entity manager statistics,
+         * which then describe the last updated frame.
+         *
+         * @param elapsed Wall-clock time elapsed since the previous frame.
+         * @return The number of fixed steps run.
+         */
+        std::size_t Update(std::chrono::nanoseconds elapsed)
+        {
+            _em.ResetChurn();
+            _profiler.BeginFrame();
+            _updating = true;
+            _frame_start = _timestep.Now();
+
+            ++_time.Frame;
+            _time.Delta = elapsed;
+            _time.Fixed = _timestep.Fixed;
+            _accumulator += elapsed;
+
+            RunPhase(Phase::Input);
+
+            std::size_t steps{0};
+            while (_accumulator >= _timestep.Fixed && steps < _timestep.MaxSteps) {
+                RunPhase(Phase::FixedUpdate);
+                _accumulator -= _timestep.Fixed;
+                ++_time.Tick;
+                ++steps;
+            }
+            if (_accumulator >= _timestep.Fixed) {
+                _accumulator %= _timestep.Fixed;
+            }
+            _time.Alpha = std::chrono::duration<double>(_accumulator) / _timestep.Fixed;
+
+            RunPhase(Phase::Update);
+            RunPhase(Phase::PostUpdate);
+            RunPhase(Phase::Render);
+
+            CountDeferrals();
+            _updating = false;
+            _removed.clear();
+            _frame.Reset();
+            return steps;
+        }
+
+        /**
+         * @brief Runs frames until `running` becomes false.
+         *
+         * Frames are timed with a steady clock. When `Timestep::TargetFrame` is set,
+         * the thread sleeps, then yields, until the frame lasted at least that long.
+         *
+         * @param running Flag checked before each frame, usually cleared by a system.
+         */
+        void Run(const bool &running)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            auto previous = Clock::now();
+            while (running) {
+                auto start = Clock::now();
+                Update(start - previous);
+                previous = start;
+                WaitUntil(start + _timestep.TargetFrame);
+            }
+        }
+
+        /**
+         * @brief Sets the timing configuration.
+         *
+         * @param timestep Timing configuration.
+         */
+        void SetTimestep(const Timestep &timestep) noexcept
+        {
+            // Periods of the systems depend on the fixed step
+            _dirty = _dirty || timestep.Fixed != _timestep.Fixed;
+            _timestep = timestep;
+        }
+
+        /**
+         * @brief Gets the timing configuration.
+         *
+         * @return The timing configuration.
+         */
+        const Timestep &GetTimestep() const noexcept
+        {
+            return _timestep;
+        }
+
+        /**
+         * @brief Gets the timing of the last frame.
+         *
+         * @return The frame timing.
+         */
+        const FrameTime &Time() const noexcept
+        {
+            return _time;
+        }
+
+        /**
+         * @brief Gets the job system running the systems.
+         *
+         * @return The job system.
+         */
+        JobSystem &GetJobs() noexcept
+        {
+            return _jobs;
+        }
+
+        /**
+         * @brief Gets the allocator of the memory released at the end of each frame.
+         *
+         * @return The frame allocator.
+         */
+        FrameAllocator &GetFrameAllocator() noexcept
+        {
+            return _frame;
+        }
+
+        /**
+         * @brief Gets the profiler timing system updates.
+         *
+         * @return The profiler.
+         */
+        Profiler &GetProfiler() noexcept
+        {
+            return _profiler;
+        }
+
+        /**
+         * @brief Gets the counters of the work postponed by the frame budget.
+         *
+         * @return The counters, since the creation of the manager.
+         */
+        const DeferralStats &Deferrals() const noexcept
+        {
+            return _deferrals;
+        }
+
+        /**
+         * @brief Gets the number of stages of the schedule, across every phase.
+         *
+         * Systems of a stage do not conflict and may be updated concurrently.
+         *
+         * @return The number of stages.
+         */
+        std::size_t Stages()
+        {
+            RefreshSchedule();
+
+            std::size_t count{0};
+            for (auto &stages : _stages) {
+                count += stages.size();
+            }
+            return count;
+        }
+
+        /**
+         * @brief Gets the stage in which a registered system is updated, within its phase.
+         *
+         * @tparam TSystem Type of the system.
+         * @return The stage index, 0 if the system is not registered.
+         */
+        template <typename TSystem>
+        std::size_t StageOf()
+        {
+            RefreshSchedule();
+
+            auto id = GetSystemId<TSystem>();
+            return id < _slots.size() ? _slots[id].Access.Stage : 0;
+        }
+
+        /**
+         * @brief Gets at which runs of its phase a registered system is updated.
+         *
+         * @tparam TSystem Type of the system.
+         * @return The period and the offset, the system runs when the run index modulo the period equals the offset.
+         * (1, 0) if the system is not registered.
+         */
+        template <typename TSystem>
+        std::pair<std::size_t, std::size_t> TicksOf()
+        {
+            RefreshSchedule();
+
+            auto id = GetSystemId<TSystem>();
+            if (id >= _slots.size()) {
+                return {1, 0};
             }
+            return {_slots[id].Access.Period, _slots[id].Access.Offset};
         }
     
     private:
+        /**
+         * @brief Rebuilds the schedule if systems were added or removed, unless an update is iterating it.
+         *
+         * Changes made during an update are scheduled from the next phase.
+         */
+        void RefreshSchedule()
+        {
+            if (_dirty && !_updating) {
+                BuildSchedule();
+            }
+        }
+
+        /**
+         * @brief Runs the systems of a phase.
+         *
+         * Stages run one after the other, systems of a stage run concurrently,
+         * deferrable systems run last.
+         * The schedule is rebuilt first if systems were added or removed.
+         *
+         * @param phase The phase.
+         */
+        void RunPhase(Phase phase)
+        {
+            if (_dirty) {
+                BuildSchedule();
+            }
+
+            auto tick = _ticks[static_cast<std::size_t>(phase)]++;
+            for (auto &stage : _stages[static_cast<std::size_t>(phase)]) {
+                _running.clear();
+                for (auto i = stage.Begin; i < stage.End; ++i) {
+                    auto id = _order[i];
+                    auto &access = _slots[id].Access;
+
+                    // Removed systems have their flag cleared
+                    if (_active.Test(id) && tick % access.Period == access.Offset && !access.IsIdle()) {
+                        Prepare(id);
+                        _running.push_back(id);
+                    }
+                }
+                if (_running.size() == 1 || _jobs.Workers() == 0) {
+                    for (auto id : _running) {
+                        Execute(id);
+                    }
+                    continue;
+                }
+
+                JobCounter counter;
+                for (auto id : _running) {
+                    _jobs.Spawn(counter, [this, id]() {
+                        Execute(id);
+                    });
+                }
+                _jobs.Wait(counter);
+            }
+            RunDeferred(phase, tick);
+        }
+
+        /**
+         * @brief Records an update of a system about to run.
+         *
+         * @param id Identifier of the system.
+         */
+        void Prepare(SystemId id) noexcept
+        {
+            auto &slot = _slots[id];
+
+            if (slot.Access.Query) {
+                slot.Access.Seen = slot.Access.Query->Version;
+            }
+            if (slot.Access.Slices > 1) {
+                slot.System->__slice(slot.Access.Runs % slot.Access.Slices, slot.Access.Slices);
+            }
+            ++slot.Access.Runs;
+        }
+
+        /**
+         * @brief Runs the deferrable systems of a phase by decreasing priority, on the calling thread.
+         *
+         * Once the frame budget is spent, systems are postponed to the next frame,
+         * unless they were postponed `Timestep::MaxDeferrals` times in a row.
+         *
+         * An unfinished system resumes at the next run of the phase, whatever its rate.
+         *
+         * @param phase The phase.
+         * @param tick Index of the run of the phase.
+         */
+        void RunDeferred(Phase phase, std::uint64_t tick)
+        {
+            for (auto id : _deferred[static_cast<std::size_t>(phase)]) {
+                auto &access = _slots[id].Access;
+
+                if (!_active.Test(id)) {
+                    continue;
+                }
+                // A postponed system runs as soon as possible too
+                if (!access.Unfinished && (access.IsIdle() || (access.Deferrals == 0 && tick % access.Period != access.Offset))) {
+                    continue;
+                }
+
+                auto budget = std::chrono::nanoseconds::max();
+                if (_timestep.Budget.count() > 0) {
+                    budget = _timestep.Budget - std::chrono::duration_cast<std::chrono::nanoseconds>(_timestep.Now() - _frame_start);
+                    if (budget.count() <= 0) {
+                        if (access.Deferrals < _timestep.MaxDeferrals) {
+                            ++access.Deferrals;
+                            ++_deferrals.Deferred;
+                            continue;
+                        }
+                        ++_deferrals.Forced;
+                        budget = std::chrono::nanoseconds{0};
+                    }
+                }
+
+                Prepare(id);
+                access.Deferrals = 0;
+
+                auto finished = Execute(id, budget);
+                // The system runs alone, it may have added systems and reallocated the slots
+                _slots[id].Access.Unfinished = !finished;
+                if (!finished) {
+                    ++_deferrals.Sliced;
+                }
+            }
+        }
+
+        void CountDeferrals() noexcept
+        {
+            if (_timestep.Budget.count() > 0 && _timestep.Now() - _frame_start > _timestep.Budget) {
+                ++_deferrals.OverBudget;
+            }
+
+            _deferrals.Pending = 0;
+            for (auto &deferred : _deferred) {
+                for (auto id : deferred) {
+                    auto &access = _slots[id].Access;
+                    _deferrals.Pending += access.Unfinished || access.Deferrals > 0;
+                }
+            }
+        }
+
+        bool Execute(SystemId id, std::chrono::nanoseconds budget)
+        {
+            auto system = _slots[id].System.get();
+
+            if constexpr (Profiler::Enabled) {
+                auto start = Profiler::Clock::now();
+                auto finished = system->Resume(budget);
+                _profiler.Record(id, start, Profiler::Clock::now());
+                return finished;
+            }
+            else {
+                return system->Resume(budget);
+            }
+        }
+
+        void Execute(SystemId id)
+        {
+            auto system = _slots[id].System.get();
+
+            if constexpr (Profiler::Enabled) {
+                auto start = Profiler::Clock::now();
+                system->Update();
+                _profiler.Record(id, start, Profiler::Clock::now());
+            }
+            else {
+                system->Update();
+            }
+        }
+
+        /**
+         * @brief Groups systems of each phase in stages.
+         *
+         * A system is placed one stage after the last earlier system of its phase it conflicts with,
+         * systems keep their relative order whenever they conflict.
+         * The schedule is flattened in execution order, phase by phase then stage by stage.
+         * Deferrable systems are kept apart, sorted by decreasing priority.
+         */
+        void BuildSchedule()
+        {
+            Stagger();
+
+            _order.clear();
+            for (auto &deferred : _deferred) {
+                deferred.clear();
+            }
+            for (SystemId id = 0; id < _slots.size(); ++id) {
+                if (!_slots[id].System) {
+                    continue;
+                }
+
+                auto &access = _slots[id].Access;
+                if (access.Deferrable) {
+                    _deferred[static_cast<std::size_t>(access.PhaseOf)].push_back(id);
+                    continue;
+                }
+                access.Stage = 0;
+                for (auto other : _order) {
+                    auto &placed = _slots[other].Access;
+                    if (placed.PhaseOf == access.PhaseOf && access.Conflicts(placed)) {
+                        access.Stage = std::max(access.Stage, placed.Stage + 1);
+                    }
+                }
+                _order.push_back(id);
+            }
+
+            std::stable_sort(_order.begin(), _order.end(), [this](SystemId lhs, SystemId rhs) {
+                auto &left = _slots[lhs].Access;
+                auto &right = _slots[rhs].Access;
+                return std::make_pair(left.PhaseOf, left.Stage) < std::make_pair(right.PhaseOf, right.Stage);
+            });
+
+            for (auto &deferred : _deferred) {
+                std::stable_sort(deferred.begin(), deferred.end(), [this](SystemId lhs, SystemId rhs) {
+                    return _slots[lhs].Access.Priority > _slots[rhs].Access.Priority;
+                });
+            }
+
+            for (auto &stages : _stages) {
+                stages.clear();
+            }
+            for (std::size_t i = 0; i < _order.size(); ++i) {
+                auto &access = _slots[_order[i]].Access;
+                auto &stages = _stages[static_cast<std::size_t>(access.PhaseOf)];
+                if (access.Stage >= stages.size()) {
+                    stages.push_back(Stage{i, i});
+                }
+                stages.back().End = i + 1;
+            }
+            _dirty = false;
+        }
+
+        /**
+         * @brief Converts the rates of the systems into periods and spreads them over the runs of their phase.
+         *
+         * Each system takes the offset sharing the fewest runs with the systems already placed in its phase:
+         * two systems of periods P and Q meet once every lcm(P, Q) runs when their offsets are equal modulo gcd(P, Q).
+         */
+        void Stagger()
+        {
+            std::vector<SystemId> placed;
+
+            for (SystemId id = 0; id < _slots.size(); ++id) {
+                if (!_slots[id].System) {
+                    continue;
+                }
+
+                auto &access = _slots[id].Access;
+                access.Period = PeriodOf(access.Rate);
+                access.Offset = 0;
+                if (access.Period == 1) {
+                    continue;
+                }
+
+                auto best = std::numeric_limits<double>::max();
+                for (std::size_t offset = 0; offset < access.Period; ++offset) {
+                    double shared{0};
+                    for (auto other : placed) {
+                        auto &rhs = _slots[other].Access;
+                        auto gcd = std::gcd(access.Period, rhs.Period);
+                        if (rhs.PhaseOf == access.PhaseOf && offset % gcd == rhs.Offset % gcd) {
+                            shared += 1.0 / std::lcm(access.Period, rhs.Period);
+                        }
+                    }
+                    if (shared < best) {
+                        best = shared;
+                        access.Offset = offset;
+                    }
+                }
+                placed.push_back(id);
+            }
+        }
+
+        /**
+         * @brief Gets the number of runs of a phase between two updates of a system.
+         *
+         * @param rate Updates per second of the system, 0 for every run.
+         * @return The period, at least 1.
+         */
+        std::size_t PeriodOf(unsigned rate) const noexcept
+        {
+            if (rate == 0) {
+                return 1;
+            }
+
+            auto period = std::chrono::duration<double>(std::chrono::seconds{1}) / rate / _timestep.Fixed;
+            return std::max<std::size_t>(static_cast<std::size_t>(std::llround(period)), 1);
+        }
+
+        /**
+         * @brief Waits until a deadline, sleeping while it is far enough then yielding.
+         *
+         * @param deadline Time point to wait for.
+         */
+        static void WaitUntil(std::chrono::steady_clock::time_point deadline)
+        {
+            // Sleeping may overshoot by about the scheduler granularity
+            static constexpr std::chrono::milliseconds slack{1};
+
+            auto now = std::chrono::steady_clock::now();
+            if (deadline - now > slack) {
+                std::this_thread::sleep_for(deadline - now - slack);
+            }
+            while (std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+        }
+
+        template <typename Traits>
+        static AccessInfo MakeAccess()
+        {
+            static_assert(Traits::RateOf == 0 || Traits::PhaseOf == Phase::FixedUpdate,
+                          "Rate needs InPhase<Phase::FixedUpdate>, other phases run once per frame whatever the frame rate");
+
+            AccessInfo access;
+
+            access.Reads = ComponentIds(typename Traits::ReadList{});
+            access.Writes = ComponentIds(typename Traits::WriteList{});
+            access.Exclusive = !Traits::IsDeclared || Traits::IsStructural;
+            access.PhaseOf = Traits::PhaseOf;
+            access.SkipUnchanged = Traits::SkipsUnchanged;
+            access.Deferrable = Traits::IsDeferrable;
+            access.Priority = Traits::Priority;
+            access.Rate = Traits::RateOf;
+            access.Slices = Traits::SlicesOf;
+            return access;
+        }
+
+        const QueryCache<EntityType> *TrackQuery(meta::TypeList<>) noexcept
+        {
+            return nullptr;
+        }
+
+        template <typename ...Components>
+        const QueryCache<EntityType> *TrackQuery(meta::TypeList<Components...>)
+        {
+            return &_em.template Track<Components...>();
+        }
+
+        template <typename ...Components>
+        static std::vector<ComponentId> ComponentIds(meta::TypeList<Components...>)
+        {
+            return {GetComponentId<Components>()...};
+        }
+
+        template <typename Component>
+        static inline ComponentId GetComponentId() noexcept
+        {
+            static ComponentId id{GenerateComponentId()};
+
+            return id;
+        }
+
+        static inline ComponentId GenerateComponentId() noexcept
+        {
+            static std::atomic<ComponentId> cur{0};
+
+            return cur++;
+        }
+
         template <typename TSystem>
         static constexpr void IsValidSystem()
         {
@@ -237,7 +1124,7 @@ namespace indie::ecs
 
         static inline SystemId GenerateTypeId() noexcept
         {
-            static SystemId cur{0};
+            static std::atomic<SystemId> cur{0};
 
             return cur++;
         }
@@ -253,9 +1140,40 @@ namespace indie::ecs
         }
 
     private:
-        SystemMap _systems;
+        /*! Indexed by system identifier */
+        std::vector<Slot> _slots;
+        /*! Active flag of each system, indexed by system identifier */
+        details::BitSet _active;
+        /*! Systems removed during the current update, destroyed at its end */
+        std::vector<std::unique_ptr<SystemType>> _removed;
+        bool _updating{false};
+
+        /*! Systems in execution order, rebuilt when systems are added or removed */
+        std::vector<SystemId> _order;
+        /*! Ranges of `_order`, grouped by phase */
+        std::vector<Stage> _stages[PhasesCount];
+        /*! Deferrable systems of each phase, by decreasing priority */
+        std::vector<SystemId> _deferred[PhasesCount];
+        std::vector<SystemId> _running;
+        bool _dirty{true};
 
         EntityManagerType &_em;
+
+        JobSystem _jobs;
+        FrameAllocator _frame;
+
+        Profiler _profiler;
+
+        Timestep _timestep;
+        FrameTime _time;
+        /*! Wall-clock time not yet simulated by fixed steps */
+        std::chrono::nanoseconds _accumulator{0};
+
+        /*! Number of runs of each phase */
+        std::uint64_t _ticks[PhasesCount]{};
+
+        std::chrono::steady_clock::time_point _frame_start;
+        DeferralStats _deferrals;
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <type_traits>
+#include <cstddef>
+
+#include <indie/meta/TypeList.hpp>
+
+#include "./Entity.hpp"
+
+namespace indie::ecs
+{
+    /**
+     * @brief Declares components a system only reads.
+     *
+     * @tparam Components Types of the components.
+     */
+    template <typename ...Components>
+    struct Reads
+    {};
+
+    /**
+     * @brief Declares components a system reads and writes.
+     *
+     * @tparam Components Types of the components.
+     */
+    template <typename ...Components>
+    struct Writes
+    {};
+
+    /**
+     * @brief Declares a system doing structural changes
+     * (creating or destroying entities, assigning or removing components).
+     *
+     * Such a system is a sync point: it never runs concurrently with another system.
+     */
+    struct Structural
+    {};
+
+    /**
+     * @brief Phases of a frame, run in this order.
+     *
+     */
+    enum class Phase
+    {
+        Input,
+        /*! Simulation, run zero or more times per frame at a fixed timestep */
+        FixedUpdate,
+        Update,
+        PostUpdate,
+        /*! Presentation, may interpolate between the last two fixed steps */
+        Render
+    };
+
+    /*! Number of phases */
+    static constexpr std::size_t PhasesCount = 5;
+
+    /**
+     * @brief Declares the phase in which a system is updated, `Phase::Update` by default.
+     *
+     * @tparam P The phase.
+     */
+    template <Phase P>
+    struct InPhase
+    {};
+
+    /**
+     * @brief Declares the entities a system iterates.
+     *
+     * The system manager tracks the query when the system is added,
+     * the system reads the matching entities from `_query` and is skipped while none matches.
+     *
+     * @tparam Components Types of the components an entity must own.
+     */
+    template <typename Component, typename ...Components>
+    struct Query
+    {};
+
+    /**
+     * @brief Skips a system whose query matches the same entities as at its previous update.
+     *
+     * Only entities entering or leaving the query are noticed, not modified components.
+     */
+    struct SkipUnchanged
+    {};
+
+    /**
+     * @brief Declares a system which may be postponed when the frame runs out of budget.
+     *
+     * Deferrable systems run after the other systems of their phase, by decreasing priority,
+     * and receive the time left in the frame budget through `Resume(budget)`.
+     *
+     * @tparam Priority Systems with a higher priority run first.
+     */
+    template <int Priority = 0>
+    struct Deferrable
+    {};
+
+    /**
+     * @brief Declares the rate at which a system is updated, every fixed step by default.
+     *
+     * Only allowed with `InPhase<Phase::FixedUpdate>`, whose runs are evenly spaced in simulated time:
+     * the rate is converted to a period in fixed steps. Systems are staggered so that low-rate systems
+     * do not all run at the same tick.
+     *
+     * @tparam Hz Updates per second.
+     */
+    template <unsigned Hz>
+    struct Rate
+    {
+        static_assert(Hz > 0, "Rate must be positive");
+    };
+
+    /**
+     * @brief Splits the work of a system across runs, over a round-robin of entity ranges.
+     *
+     * Each run of the system covers one of `Slices` ranges, given by `SliceRange`,
+     * so every entity is updated once every `Slices` runs.
+     *
+     * @tparam Slices Number of ranges.
+     */
+    template <std::size_t Slices>
+    struct Sliced
+    {
+        static_assert(Slices > 0, "Sliced needs at least one slice");
+    };
+
+    namespace details
+    {
+        /**
+         * @brief Placeholder declaration, used when a system only gives its entity type.
+         *
+         */
+        struct NoAccess
+        {};
+
+        template <typename T>
+        struct IsAccess : std::false_type
+        {};
+        template <typename ...Components>
+        struct IsAccess<Reads<Components...>> : std::true_type
+        {};
+        template <typename ...Components>
+        struct IsAccess<Writes<Components...>> : std::true_type
+        {};
+        template <>
+        struct IsAccess<Structural> : std::true_type
+        {};
+        template <Phase P>
+        struct IsAccess<InPhase<P>> : std::true_type
+        {};
+        template <typename ...Components>
+        struct IsAccess<Query<Components...>> : std::true_type
+        {};
+        template <>
+        struct IsAccess<SkipUnchanged> : std::true_type
+        {};
+        template <int Priority>
+        struct IsAccess<Deferrable<Priority>> : std::true_type
+        {};
+        template <unsigned Hz>
+        struct IsAccess<Rate<Hz>> : std::true_type
+        {};
+        template <std::size_t Slices>
+        struct IsAccess<Sliced<Slices>> : std::true_type
+        {};
+
+        /**
+         * @brief Merges access declarations of a system.
+         *
+         * @tparam Access Access declarations.
+         */
+        template <typename ...Access>
+        struct AccessTraits
+        {
+            using ReadList = meta::TypeList<>;
+            using WriteList = meta::TypeList<>;
+            static constexpr bool IsStructural = false;
+            static constexpr bool HasAccess = false;
+            static constexpr Phase PhaseOf = Phase::Update;
+            using QueryList = meta::TypeList<>;
+            static constexpr bool SkipsUnchanged = false;
+            static constexpr bool IsDeferrable = false;
+            static constexpr int Priority = 0;
+            /*! Updates per second, 0 for every run of the phase */
+            static constexpr unsigned RateOf = 0;
+            static constexpr std::size_t SlicesOf = 1;
+        };
+        template <typename ...Components, typename ...Access>
+        struct AccessTraits<Reads<Components...>, Access...>
+        {
+            using ReadList = typename meta::TypeListCat<meta::TypeList<Components...>, typename AccessTraits<Access...>::ReadList>::Type;
+            using WriteList = typename AccessTraits<Access...>::WriteList;
+            static constexpr bool IsStructural = AccessTraits<Access...>::IsStructural;
+            static constexpr bool HasAccess = true;
+            static constexpr Phase PhaseOf = AccessTraits<Access...>::PhaseOf;
+            using QueryList = typename AccessTraits<Access...>::QueryList;
+            static constexpr bool SkipsUnchanged = AccessTraits<Access...>::SkipsUnchanged;
+            static constexpr bool IsDeferrable = AccessTraits<Access...>::IsDeferrable;
+            static constexpr int Priority = AccessTraits<Access...>::Priority;
+            static constexpr unsigned RateOf = AccessTraits<Access...>::RateOf;
+            static constexpr std::size_t SlicesOf = AccessTraits<Access...>::SlicesOf;
+        };
+        template <typename ...Components, typename ...Access>
+        struct AccessTraits<Writes<Components...>, Access...>
+        {
+            using ReadList = typename AccessTraits<Access...>::ReadList;
+            using WriteList = typename meta::TypeListCat<meta::TypeList<Components...>, typename AccessTraits<Access...>::WriteList>::Type;
+            static constexpr bool IsStructural = AccessTraits<Access...>::IsStructural;
+            static constexpr bool HasAccess = true;
+            static constexpr Phase PhaseOf = AccessTraits<Access...>::PhaseOf;
+            using QueryList = typename AccessTraits<Access...>::QueryList;
+            static constexpr bool SkipsUnchanged = AccessTraits<Access...>::SkipsUnchanged;
+            static constexpr bool IsDeferrable = AccessTraits<Access...>::IsDeferrable;
+            static constexpr int Priority = AccessTraits<Access...>::Priority;
+            static constexpr unsigned RateOf = AccessTraits<Access...>::RateOf;
+            static constexpr std::size_t SlicesOf = AccessTraits<Access...>::SlicesOf;
+        };
+        template <typename ...Access>
+        struct AccessTraits<Structural, Access...> : AccessTraits<Access...>
+        {
+            static constexpr bool IsStructural = true;
+            static constexpr bool HasAccess = true;
+        };
+        template <Phase P, typename ...Access>
+        struct AccessTraits<InPhase<P>, Access...> : AccessTraits<Access...>
+        {
+            static constexpr Phase PhaseOf = P;
+        };
+        template <typename ...Components, typename ...Access>
+        struct AccessTraits<Query<Components...>, Access...> : AccessTraits<Access...>
+        {
+            using QueryList = meta::TypeList<Components...>;
+        };
+        template <typename ...Access>
+        struct AccessTraits<SkipUnchanged, Access...> : AccessTraits<Access...>
+        {
+            static constexpr bool SkipsUnchanged = true;
+        };
+        template <int P, typename ...Access>
+        struct AccessTraits<Deferrable<P>, Access...> : AccessTraits<Access...>
+        {
+            static constexpr bool IsDeferrable = true;
+            static constexpr int Priority = P;
+        };
+        template <unsigned Hz, typename ...Access>
+        struct AccessTraits<Rate<Hz>, Access...> : AccessTraits<Access...>
+        {
+            static constexpr unsigned RateOf = Hz;
+        };
+        template <std::size_t Slices, typename ...Access>
+        struct AccessTraits<Sliced<Slices>, Access...> : AccessTraits<Access...>
+        {
+            static constexpr std::size_t SlicesOf = Slices;
+        };
+        template <typename ...Access>
+        struct AccessTraits<NoAccess, Access...> : AccessTraits<Access...>
+        {};
+
+        /**
+         * @brief Splits template arguments of a system into its entity type and its access declarations.
+         *
+         * The entity type is optional and must come first:
+         * `System<>`, `System<unsigned>`, `System<Reads<A>, Writes<B>>`, `System<unsigned, Reads<A>>`.
+         *
+         * A system is declared when it gives at least one `Reads`, `Writes` or `Structural`,
+         * `InPhase`, `Query`, `SkipUnchanged`, `Deferrable`, `Rate` and `Sliced` alone do not describe any access.
+         */
+        template <typename ...Args>
+        struct SystemTraits : AccessTraits<>
+        {
+            using EntityType = Entity;
+            static constexpr bool IsDeclared = false;
+        };
+        template <typename First, typename ...Args>
+        struct SystemTraits<First, Args...> :
+            AccessTraits<std::conditional_t<IsAccess<First>::value, First, NoAccess>, Args...>
+        {
+            using EntityType = std::conditional_t<IsAccess<First>::value, Entity, First>;
+            static constexpr bool IsDeclared = AccessTraits<std::conditional_t<IsAccess<First>::value, First, NoAccess>, Args...>::HasAccess;
+        };
+    }
+}
\ No newline at end of file
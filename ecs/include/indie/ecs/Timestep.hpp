@@ -0,0 +1,68 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace indie::ecs
+{
+    /**
+     * @brief Timing configuration of the system manager frames.
+     *
+     */
+    struct Timestep
+    {
+        /*! Duration simulated by one run of the `FixedUpdate` phase */
+        std::chrono::nanoseconds Fixed{std::chrono::nanoseconds{1000000000} / 60};
+        /*! Maximum number of fixed steps run by a frame, the remaining lag is dropped */
+        std::size_t MaxSteps{5};
+        /*! Minimum duration of a frame when running the loop, 0 to never wait */
+        std::chrono::nanoseconds TargetFrame{0};
+        /*! Time a frame may take before deferrable systems are postponed, 0 for no budget */
+        std::chrono::nanoseconds Budget{0};
+        /*! Number of frames in a row a deferrable system may be postponed, it then runs over budget */
+        std::size_t MaxDeferrals{8};
+        /*! Clock measuring the time spent in a frame against the budget, the steady clock by default */
+        std::chrono::steady_clock::time_point (*Now)() noexcept{[]() noexcept {
+            return std::chrono::steady_clock::now();
+        }};
+    };
+
+    /**
+     * @brief Timing of the current frame, readable by systems.
+     *
+     */
+    struct FrameTime
+    {
+        /*! Wall-clock time elapsed since the previous frame */
+        std::chrono::nanoseconds Delta{0};
+        /*! Duration of a fixed step */
+        std::chrono::nanoseconds Fixed{0};
+        /*! Progress between the last fixed step and the next one, in [0, 1) */
+        double Alpha{0.0};
+        /*! Number of fixed steps run since the creation of the manager */
+        std::uint64_t Tick{0};
+        /*! Number of frames run since the creation of the manager */
+        std::uint64_t Frame{0};
+
+        /**
+         * @brief Gets the duration of a fixed step in seconds.
+         *
+         * @return The fixed step.
+         */
+        double FixedSeconds() const noexcept
+        {
+            return std::chrono::duration<double>(Fixed).count();
+        }
+
+        /**
+         * @brief Gets the wall-clock time elapsed since the previous frame in seconds.
+         *
+         * @return The frame delta.
+         */
+        double DeltaSeconds() const noexcept
+        {
+            return std::chrono::duration<double>(Delta).count();
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace indie::ecs::details
+{
+    /**
+     * @brief Growable set of bits packed in words.
+     *
+     * Words are updated atomically, so threads may flip different bits of the same word.
+     * Growing is not thread-safe.
+     */
+    class BitSet
+    {
+    public:
+        static constexpr std::size_t WordBits = 64;
+
+    public:
+        BitSet() = default;
+        ~BitSet() = default;
+
+        BitSet(BitSet &other) = delete;
+        BitSet(BitSet &&other) = delete;
+        BitSet &operator=(BitSet &other) = delete;
+        BitSet &operator=(BitSet &&other) = delete;
+
+        /**
+         * @brief Tells if a bit is set, bits beyond the size are cleared.
+         *
+         * @param index Index of the bit.
+         * @return True if the bit is set.
+         */
+        bool Test(std::size_t index) const noexcept
+        {
+            auto word = index / WordBits;
+
+            return word < _size && (_words[word].load(std::memory_order_relaxed) & Mask(index)) != 0;
+        }
+
+        void Set(std::size_t index) noexcept
+        {
+            _words[index / WordBits].fetch_or(Mask(index), std::memory_order_relaxed);
+        }
+
+        void Reset(std::size_t index) noexcept
+        {
+            _words[index / WordBits].fetch_and(~Mask(index), std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Grows the set to hold at least `bits` bits, new bits are cleared.
+         *
+         * @param bits Number of bits.
+         */
+        void Reserve(std::size_t bits)
+        {
+            auto size = (bits + WordBits - 1) / WordBits;
+
+            if (size <= _size) {
+                return;
+            }
+
+            auto words = std::make_unique<std::atomic<std::uint64_t>[]>(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                words[i].store(i < _size ? _words[i].load(std::memory_order_relaxed) : 0, std::memory_order_relaxed);
+            }
+            _words = std::move(words);
+            _size = size;
+        }
+
+    private:
+        static std::uint64_t Mask(std::size_t index) noexcept
+        {
+            return std::uint64_t{1} << (index % WordBits);
+        }
+
+    private:
+        std::unique_ptr<std::atomic<std::uint64_t>[]> _words;
+        /*! Number of words */
+        std::size_t _size{0};
+    };
+}
\ No newline at end of file
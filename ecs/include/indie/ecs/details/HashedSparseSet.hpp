@@ -0,0 +1,416 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define INDIE_ECS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace indie::ecs::details
+{
+    /**
+     * @brief Sparse set indexed by an open-addressing hash table.
+     *
+     * Behaves like `SparseSet` (dense storage, swap-and-pop erase, same iteration interface)
+     * but does not allocate memory proportional to the biggest stored value,
+     * which makes it suitable for sparse 64-bit identifiers.
+     *
+     * The index is a SwissTable-like table: slots are split into groups of 16
+     * control bytes which are probed at once (with SSE2 when available).
+     *
+     * @tparam T Type of the elements, must be an unsigned integer.
+     */
+    template <typename T>
+    class HashedSparseSet
+    {
+        static_assert(std::is_unsigned<T>::value, "HashedSparseSet can only contain unsigned integers");
+
+    public:
+        using SizeType = std::size_t;
+        using ValueType = T;
+
+        using ConstIterator = typename std::vector<T>::const_iterator;
+
+    private:
+        using ControlType = std::int8_t;
+        using MaskType = std::uint32_t;
+
+        static constexpr SizeType GroupWidth = 16;
+        static constexpr SizeType NotFound = ~SizeType{0};
+
+        static constexpr ControlType Empty = -128;
+        static constexpr ControlType Deleted = -2;
+
+    public:
+        /**
+         * @brief Gets the number of elements stored.
+         *
+         * @return The number of elements stored.
+         */
+        SizeType Size() const noexcept { return _dense.size(); }
+        /**
+         * @brief Gets the number of elements which can be stored without rehashing.
+         *
+         * @return The storage capacity.
+         */
+        SizeType Capacity() const noexcept { return MaxLoad(_ctrl.size()); }
+
+        /**
+         * @brief Gets the memory allocated by the set.
+         *
+         * @return Allocated bytes.
+         */
+        std::size_t Bytes() const noexcept
+        {
+            return _dense.capacity() * sizeof(ValueType) + _ctrl.capacity() * sizeof(ControlType) + _slots.capacity() * sizeof(SizeType);
+        }
+
+        /**
+         * @brief Tells if the set does not contain any element.
+         *
+         * @return True if the set contains 0 element, false otherwise.
+         */
+        bool IsEmpty() const { return _dense.empty(); }
+
+        /**
+         * @brief Makes the set empty.
+         *
+         * Keeps the allocated storage.
+         */
+        void Clear() noexcept
+        {
+            _dense.clear();
+            std::fill(_ctrl.begin(), _ctrl.end(), Empty);
+            _tombstones = 0;
+        }
+
+        /**
+         * @brief Makes the set empty and frees its storage.
+         *
+         */
+        void Release() noexcept
+        {
+            std::vector<ValueType>().swap(_dense);
+            std::vector<ControlType>().swap(_ctrl);
+            std::vector<SizeType>().swap(_slots);
+            _tombstones = 0;
+        }
+
+        /**
+         * @brief Increases storage capacity.
+         *
+         * @param count Number of elements to be able to store without rehashing.
+         */
+        void Reserve(SizeType count)
+        {
+            if (count > Capacity()) {
+                Rehash(SlotsFor(count));
+            }
+            _dense.reserve(count);
+        }
+
+        /**
+         * @brief Tells if the set contains an element.
+         *
+         * @param val Element to search.
+         * @return True if the element exists, false otherwise.
+         */
+        bool Has(const ValueType &val) const noexcept
+        {
+            return Find(val) != NotFound;
+        }
+
+        /**
+         * @brief Inserts an element in the set.
+         *
+         * @param val Element to insert.
+         */
+        void Insert(const ValueType &val)
+        {
+            if (Has(val)) {
+                return;
+            }
+            if (_dense.size() + _tombstones + 1 > Capacity()) {
+                // Only grow when tombstones are not the reason of the overload
+                Rehash(_dense.size() + 1 > Capacity() / 2 ? SlotsFor((_dense.size() + 1) * 2) : _ctrl.size());
+            }
+
+            auto hash = Hash(val);
+            auto slot = FindFreeSlot(hash);
+
+            if (_ctrl[slot] == Deleted) {
+                --_tombstones;
+            }
+            _ctrl[slot] = H2(hash);
+            _slots[slot] = _dense.size();
+            _dense.push_back(val);
+        }
+
+        /**
+         * @brief Erases an element.
+         *
+         * @param val Element to erase.
+         */
+        void Erase(const ValueType &val)
+        {
+            auto slot = Find(val);
+
+            if (slot == NotFound) {
+                return;
+            }
+
+            auto index = _slots[slot];
+            auto last = _dense.back();
+
+            if (index != _dense.size() - 1) {
+                _slots[Find(last)] = index;
+                _dense[index] = last;
+            }
+            _dense.pop_back();
+
+            // A group which still has an empty slot ends every probe sequence going through it,
+            // so the erased slot can be marked empty instead of leaving a tombstone.
+            if (MatchEmpty(slot - slot % GroupWidth) != 0) {
+                _ctrl[slot] = Empty;
+            }
+            else {
+                _ctrl[slot] = Deleted;
+                ++_tombstones;
+            }
+        }
+        /**
+         * @brief Erases an element.
+         *
+         * @param it Iterator.
+         */
+        void Erase(ConstIterator it)
+        {
+            Erase(*it);
+        }
+
+        /**
+         * @brief Swaps the positions of two elements in the dense storage.
+         *
+         * @warning
+         * Swapping elements not stored is undefined behavior.
+         *
+         * @param lhs First element.
+         * @param rhs Second element.
+         */
+        void Swap(const ValueType &lhs, const ValueType &rhs) noexcept
+        {
+            auto lhs_slot = Find(lhs);
+            auto rhs_slot = Find(rhs);
+
+            std::swap(_dense[_slots[lhs_slot]], _dense[_slots[rhs_slot]]);
+            std::swap(_slots[lhs_slot], _slots[rhs_slot]);
+        }
+
+        /**
+         * @brief Gets the index of an element.
+         *
+         * @warning
+         * Getting the index of an element not stored is undefined behavior.
+         *
+         * @param val Element.
+         * @return Index of the element.
+         */
+        SizeType IndexOf(const ValueType &val) const noexcept
+        {
+            return _slots[Find(val)];
+        }
+
+        /**
+         * @brief Gets an iterator to the beginning of the set.
+         *
+         * @return An iterator to the beginning.
+         */
+        ConstIterator Begin() const { return _dense.begin(); }
+        ConstIterator begin() const { return Begin(); }
+
+        /**
+         * @brief Gets an iterator to the ending of the set.
+         *
+         * @return An iterator to the ending.
+         */
+        ConstIterator End() const { return _dense.end(); }
+        ConstIterator end() const { return End(); }
+
+    private:
+        /**
+         * @brief Mixes the bits of a value (murmur3 finalizer).
+         *
+         * Identifiers are often sequential or share their high bits,
+         * both parts of the hash must be well distributed.
+         */
+        static std::uint64_t Hash(ValueType val) noexcept
+        {
+            auto h = static_cast<std::uint64_t>(val);
+
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+        /*! Gets the 7 bits stored in the control byte of a full slot. */
+        static ControlType H2(std::uint64_t hash) noexcept { return static_cast<ControlType>(hash & 0x7F); }
+        /*! Gets the bits used to select the first probed group. */
+        static std::uint64_t H1(std::uint64_t hash) noexcept { return hash >> 7; }
+
+        /*! Maximum number of elements for a given slot count (7/8 load factor). */
+        static SizeType MaxLoad(SizeType slots) noexcept { return slots - slots / 8; }
+
+        /*! Number of slots (power of two, multiple of a group) needed to store `count` elements. */
+        static SizeType SlotsFor(SizeType count) noexcept
+        {
+            SizeType slots = GroupWidth;
+
+            while (MaxLoad(slots) < count) {
+                slots *= 2;
+            }
+            return slots;
+        }
+
+        MaskType Match(SizeType group, ControlType h2) const noexcept
+        {
+#ifdef INDIE_ECS_SSE2
+            auto ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&_ctrl[group]));
+            return static_cast<MaskType>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2))));
+#else
+            MaskType mask{0};
+            for (SizeType i = 0; i < GroupWidth; ++i) {
+                mask |= static_cast<MaskType>(_ctrl[group + i] == h2) << i;
+            }
+            return mask;
+#endif
+        }
+        MaskType MatchEmpty(SizeType group) const noexcept
+        {
+            return Match(group, Empty);
+        }
+        MaskType MatchFree(SizeType group) const noexcept
+        {
+#ifdef INDIE_ECS_SSE2
+            // Empty and deleted are the only negative values lower than -1
+            auto ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&_ctrl[group]));
+            return static_cast<MaskType>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)));
+#else
+            MaskType mask{0};
+            for (SizeType i = 0; i < GroupWidth; ++i) {
+                mask |= static_cast<MaskType>(_ctrl[group + i] < -1) << i;
+            }
+            return mask;
+#endif
+        }
+
+        static SizeType LowestBit(MaskType mask) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<SizeType>(__builtin_ctz(mask));
+#else
+            SizeType bit{0};
+            while (!(mask & 1)) {
+                mask >>= 1;
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        /**
+         * @brief Finds the slot of an element.
+         *
+         * Groups are probed in triangular order, which visits every group
+         * of a power of two table.
+         *
+         * @param val Element to search.
+         * @return The slot index, `NotFound` if the element is not stored.
+         */
+        SizeType Find(const ValueType &val) const noexcept
+        {
+            if (_ctrl.empty()) {
+                return NotFound;
+            }
+
+            auto hash = Hash(val);
+            auto h2 = H2(hash);
+            auto groups_mask = _ctrl.size() / GroupWidth - 1;
+            auto group = H1(hash) & groups_mask;
+
+            for (SizeType step = 1; step <= groups_mask + 1; ++step) {
+                auto base = group * GroupWidth;
+
+                for (auto mask = Match(base, h2); mask != 0; mask &= mask - 1) {
+                    auto slot = base + LowestBit(mask);
+                    if (_dense[_slots[slot]] == val) {
+                        return slot;
+                    }
+                }
+                if (MatchEmpty(base) != 0) {
+                    return NotFound;
+                }
+                group = (group + step) & groups_mask;
+            }
+            return NotFound;
+        }
+
+        /**
+         * @brief Finds the first empty or deleted slot of a probe sequence.
+         *
+         * The table must have at least one free slot.
+         */
+        SizeType FindFreeSlot(std::uint64_t hash) const noexcept
+        {
+            auto groups_mask = _ctrl.size() / GroupWidth - 1;
+            auto group = H1(hash) & groups_mask;
+
+            for (SizeType step = 1;; ++step) {
+                auto base = group * GroupWidth;
+                auto mask = MatchFree(base);
+
+                if (mask != 0) {
+                    return base + LowestBit(mask);
+                }
+                group = (group + step) & groups_mask;
+            }
+        }
+
+        /**
+         * @brief Rebuilds the index with a new number of slots.
+         *
+         * Dense storage is left untouched, so iteration order is preserved.
+         *
+         * @param slots New number of slots.
+         */
+        void Rehash(SizeType slots)
+        {
+            _ctrl.assign(slots, Empty);
+            _slots.assign(slots, 0);
+            _tombstones = 0;
+
+            for (SizeType index = 0; index < _dense.size(); ++index) {
+                auto hash = Hash(_dense[index]);
+                auto slot = FindFreeSlot(hash);
+
+                _ctrl[slot] = H2(hash);
+                _slots[slot] = index;
+            }
+        }
+
+    private:
+        std::vector<ValueType> _dense;
+
+        std::vector<ControlType> _ctrl;
+        std::vector<SizeType> _slots;
+
+        SizeType _tombstones{0};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+namespace indie::ecs::details
+{
+    /**
+     * @brief Type-erased callable stored inline, never allocates.
+     *
+     * Callables must be trivially copyable (lambdas capturing values, pointers or references),
+     * so jobs are copied bytewise and never destroyed.
+     */
+    class Job
+    {
+    public:
+        /*! Maximum size of the stored callable, capture pointers or references for bigger states */
+        static constexpr std::size_t Capacity = 48;
+
+    public:
+        Job() = default;
+
+        template <typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, Job>>>
+        explicit Job(Func &&func) noexcept
+        {
+            using Type = std::decay_t<Func>;
+
+            static_assert(std::is_trivially_copyable_v<Type>, "Job state must be trivially copyable, capture by reference or pointer");
+            static_assert(sizeof(Type) <= Capacity, "Job state too big, capture by reference or pointer");
+            static_assert(alignof(Type) <= alignof(std::max_align_t), "Job state over-aligned");
+
+            new (&_storage) Type(std::forward<Func>(func));
+            _invoke = [](void *storage) {
+                (*static_cast<Type *>(storage))();
+            };
+        }
+
+        /**
+         * @brief Runs the callable, `JobSystem::Spawn` wraps it so that it never throws.
+         *
+         */
+        void operator()() noexcept
+        {
+            _invoke(&_storage);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return _invoke != nullptr;
+        }
+
+    private:
+        std::aligned_storage_t<Capacity, alignof(std::max_align_t)> _storage;
+        void (*_invoke)(void *){nullptr};
+    };
+
+    /**
+     * @brief Double-ended queue of jobs.
+     *
+     * The owner pushes and pops at the back, most recent jobs first,
+     * thieves take the oldest jobs at the front.
+     * Storage is a growing ring buffer, reused once it reached its peak size.
+     */
+    class JobQueue
+    {
+    public:
+        JobQueue() :
+            _jobs(64)
+        {}
+
+        void Push(const Job &job)
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            if (_size == _jobs.size()) {
+                Grow();
+            }
+            _jobs[(_head + _size) % _jobs.size()] = job;
+            ++_size;
+        }
+
+        bool Pop(Job &job)
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            if (_size == 0) {
+                return false;
+            }
+            --_size;
+            job = _jobs[(_head + _size) % _jobs.size()];
+            return true;
+        }
+
+        bool Steal(Job &job)
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            if (_size == 0) {
+                return false;
+            }
+            job = _jobs[_head];
+            _head = (_head + 1) % _jobs.size();
+            --_size;
+            return true;
+        }
+
+    private:
+        void Grow()
+        {
+            std::vector<Job> jobs(_jobs.size() * 2);
+
+            for (std::size_t i = 0; i < _size; ++i) {
+                jobs[i] = _jobs[(_head + i) % _jobs.size()];
+            }
+            _jobs = std::move(jobs);
+            _head = 0;
+        }
+
+    private:
+        std::mutex _mutex;
+        std::vector<Job> _jobs;
+        std::size_t _head{0};
+        std::size_t _size{0};
+    };
+}
\ No newline at end of file
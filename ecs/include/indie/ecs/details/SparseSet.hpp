@@ -2,6 +2,8 @@
 
 #include <type_traits>
 #include <vector>
+#include <cstddef>
+#include <utility>
 
 namespace indie::ecs::details
 {
@@ -30,6 +32,16 @@ namespace indie::ecs::details
          */
         SizeType Capacity() const noexcept { return _capacity; }
 
+        /**
+         * @brief Gets the memory allocated by the sparse set.
+         * 
+         * @return Allocated bytes.
+         */
+        std::size_t Bytes() const noexcept
+        {
+            return (_dense.capacity() + _sparse.capacity()) * sizeof(ValueType);
+        }
+
         /**
          * @brief Tells if a sparse set do not contain any element.
          * 
@@ -43,6 +55,18 @@ namespace indie::ecs::details
          */
         void Clear() noexcept { _size = 0; }
 
+        /**
+         * @brief Makes the sparse set empty and frees its storage.
+         * 
+         */
+        void Release() noexcept
+        {
+            std::vector<ValueType>().swap(_dense);
+            std::vector<ValueType>().swap(_sparse);
+            _size = 0;
+            _capacity = 0;
+        }
+
         /**
          * @brief Increases storage capacity.
          * 
@@ -93,9 +117,9 @@ namespace indie::ecs::details
         /**
          * @brief Erases an element.
          * 
-         * @param val Element to erase.
+         * @param val Element to erase, taken by copy since it may alias the dense storage.
          */
-        void Erase(const ValueType &val)
+        void Erase(const ValueType val)
         {
             if (Has(val)) {
                 _dense[_sparse[val]] = _dense[_size - 1];
@@ -114,6 +138,21 @@ namespace indie::ecs::details
             Erase(*it);
         }
 
+        /**
+         * @brief Swaps the positions of two elements in the dense storage.
+         * 
+         * @warning
+         * Swapping elements not stored is undefined behavior.
+         * 
+         * @param lhs First element.
+         * @param rhs Second element.
+         */
+        void Swap(const ValueType &lhs, const ValueType &rhs) noexcept
+        {
+            std::swap(_dense[_sparse[lhs]], _dense[_sparse[rhs]]);
+            std::swap(_sparse[lhs], _sparse[rhs]);
+        }
+
         /**
          * @brief Gets the index of an element.
          * 
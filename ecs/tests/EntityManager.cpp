@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <indie/ecs/EntityManager.hpp>
 
 struct Stamina
@@ -88,4 +90,258 @@ TEST(EntityRegistry, 4Entities)
     
     reg.Reset();
     ASSERT_EQ((reg.Size()), 0);
+}
+
+TEST(EntityRegistry, TrackedQueries)
+{
+    indie::ecs::EntityManager<unsigned> reg{};
+
+    reg.Track<Stamina, Mana>();
+    ASSERT_EQ((reg.Size<Stamina, Mana>()), 0);
+    ASSERT_TRUE((reg.IsEmpty<Stamina, Mana>()));
+
+    std::vector<unsigned> ets;
+    for (int i = 0; i < 10; ++i) {
+        ets.push_back(reg.Create());
+        reg.Assign<Stamina>(ets.back());
+        if (i % 2 == 0) {
+            reg.Assign<Mana>(ets.back());
+        }
+    }
+    ASSERT_EQ((reg.Size<Stamina, Mana>()), 5);
+    ASSERT_EQ((reg.Size<Mana, Stamina>()), 5);
+
+    // Assigning twice does nothing
+    reg.Assign<Mana>(ets[0]);
+    reg.AssignOrReplace<Mana>(ets[0], 3);
+    ASSERT_EQ((reg.Size<Stamina, Mana>()), 5);
+
+    reg.AssignOrReplace<Mana>(ets[1], 3);
+    ASSERT_EQ((reg.Size<Stamina, Mana>()), 6);
+
+    reg.Delete<Stamina>(ets[0]);
+    ASSERT_EQ((reg.Size<Stamina, Mana>()), 5);
+
+    reg.Destroy(ets[2], ets[3]);
+    ASSERT_EQ((reg.Size<Stamina, Mana>()), 4);
+
+    // Tracking late counts existing entities
+    reg.Track<Mana, Stamina>();
+    ASSERT_EQ((reg.Size<Mana, Stamina>()), 4);
+
+    reg.Reset<Mana>();
+    ASSERT_EQ((reg.Size<Stamina, Mana>()), 0);
+    ASSERT_EQ((reg.Size<Mana, Stamina>()), 0);
+    ASSERT_TRUE((reg.IsEmpty<Stamina, Mana>()));
+}
+
+TEST(EntityRegistry, QueryCache)
+{
+    indie::ecs::EntityManager<unsigned> reg{};
+
+    auto &query = reg.Track<Stamina, Mana>();
+    ASSERT_EQ(&query, (&reg.Track<Stamina, Mana>()));
+
+    for (int i = 0; i < 6; ++i) {
+        auto et = reg.Create();
+        reg.Assign<Stamina>(et);
+        if (i % 3 == 0) {
+            reg.Assign<Mana>(et);
+        }
+    }
+    ASSERT_EQ(query.Entities.Size(), 2);
+    ASSERT_TRUE(query.Entities.Has(0));
+    ASSERT_TRUE(query.Entities.Has(3));
+
+    // Replacing a component does not change the list
+    auto version = query.Version;
+    reg.AssignOrReplace<Mana>(0, 7);
+    ASSERT_EQ(query.Version, version);
+
+    reg.Assign<Mana>(4);
+    ASSERT_TRUE(query.Entities.Has(4));
+    ASSERT_GT(query.Version, version);
+
+    reg.Delete<Stamina>(0);
+    reg.Destroy(3);
+    ASSERT_EQ(query.Entities.Size(), 1);
+    ASSERT_TRUE(query.Entities.Has(4));
+
+    // ForEach only visits the list, removing the current entity is allowed
+    reg.Assign<Mana>(1);
+    reg.Assign<Mana>(2);
+    int visited{0};
+    reg.ForEach<Stamina, Mana>([&](auto et, Stamina &, Mana &) {
+        ++visited;
+        reg.Delete<Mana>(et);
+    });
+    ASSERT_EQ(visited, 3);
+    ASSERT_EQ(query.Entities.Size(), 0);
+
+    reg.Assign<Mana>(5);
+    reg.Reset();
+    ASSERT_EQ(query.Entities.Size(), 0);
+}
+
+TEST(EntityRegistry, PoolStats)
+{
+    indie::ecs::EntityManager<unsigned> reg{};
+
+    auto empty = reg.Stats<Stamina>();
+    ASSERT_EQ(empty.Size, 0);
+    ASSERT_EQ(empty.Bytes, 0);
+
+    for (int i = 0; i < 100; ++i) {
+        reg.Assign<Stamina>(reg.Create());
+    }
+    reg.Delete<Stamina>(5);
+
+    auto stats = reg.Stats<Stamina>();
+    ASSERT_EQ(stats.Size, 99);
+    ASSERT_GE(stats.Capacity, 99);
+    ASSERT_GE(stats.Bytes, 99 * sizeof(Stamina));
+    ASSERT_EQ(stats.Churn, 101);
+
+    reg.ResetChurn();
+    reg.Destroy(7);
+    ASSERT_EQ(reg.Stats<Stamina>().Churn, 1);
+
+    reg.Assign<Mana>(0);
+    ASSERT_EQ(reg.Stats().size(), 2);
+}
+
+struct Tracked
+{
+    Tracked() { ++Alive; }
+    Tracked(const Tracked &) { ++Alive; }
+    Tracked(Tracked &&) { ++Alive; }
+    Tracked &operator=(const Tracked &) = default;
+    Tracked &operator=(Tracked &&) = default;
+    ~Tracked() { --Alive; }
+
+    static inline int Alive{0};
+};
+
+TEST(EntityRegistry, BulkReset)
+{
+    indie::ecs::EntityManager<unsigned> reg{};
+    std::vector<unsigned> ets;
+
+    for (int i = 0; i < 100000; ++i) {
+        ets.push_back(reg.Create());
+        reg.Assign<Tracked>(ets.back());
+        if (i % 3 == 0) {
+            reg.Assign<Mana>(ets.back());
+        }
+    }
+    reg.Destroy(ets[10], ets[20]);
+    reg.Track<Tracked, Mana>();
+    ASSERT_EQ(Tracked::Alive, 99998);
+
+    reg.Reset();
+    ASSERT_EQ(reg.Size(), 0);
+    ASSERT_EQ(Tracked::Alive, 0);
+    ASSERT_EQ(reg.Size<Tracked>(), 0);
+    ASSERT_EQ(reg.Size<Mana>(), 0);
+    ASSERT_EQ((reg.Size<Tracked, Mana>()), 0);
+    for (auto et : ets) {
+        ASSERT_FALSE(reg.Exists(et));
+        ASSERT_FALSE(reg.Has<Tracked>(et));
+        ASSERT_FALSE(reg.Has<Mana>(et));
+    }
+    // Storage is kept for the next level
+    ASSERT_GE(reg.Capacity<Tracked>(), 99998);
+
+    // Next level starts from a clean registry
+    auto et = reg.Create();
+    ASSERT_EQ(et, 0);
+    ASSERT_FALSE(reg.Has<Tracked>(et));
+    reg.Assign<Mana>(et);
+    ASSERT_EQ((reg.Size<Tracked, Mana>()), 0);
+    reg.Assign<Tracked>(et);
+    ASSERT_EQ((reg.Size<Tracked, Mana>()), 1);
+
+    reg.Reset(indie::ecs::ResetMode::Release);
+    ASSERT_EQ(reg.Size(), 0);
+    ASSERT_EQ(Tracked::Alive, 0);
+    ASSERT_EQ(reg.Capacity(), 0);
+    ASSERT_EQ(reg.Stats<Tracked>().Bytes, 0);
+    ASSERT_EQ(reg.Stats<Mana>().Bytes, 0);
+    ASSERT_FALSE(reg.Exists(et));
+}
+
+TEST(EntityRegistry, DestroyByComponents)
+{
+    indie::ecs::EntityManager<unsigned> reg{};
+
+    for (int i = 0; i < 100; ++i) {
+        auto et = reg.Create();
+        if (i % 2 == 0) {
+            reg.Assign<Mana>(et);
+        }
+    }
+    reg.Destroy<Mana>();
+    ASSERT_EQ(reg.Size(), 50);
+    ASSERT_EQ(reg.Size<Mana>(), 0);
+}
+
+TEST(EntityRegistry, DestroyBatch)
+{
+    indie::ecs::EntityManager<unsigned> reg{};
+    std::vector<unsigned> batch;
+
+    for (int i = 0; i < 100; ++i) {
+        auto et = reg.Create();
+        reg.Assign<Mana>(et);
+        if (i % 3 == 0) {
+            reg.Assign<Stamina>(et);
+            batch.push_back(et);
+        }
+    }
+    auto &query = reg.Track<Mana, Stamina>();
+    ASSERT_EQ(query.Entities.Size(), 34u);
+
+    reg.DestroyBatch(batch.begin(), batch.end());
+    ASSERT_EQ(reg.Size(), 66);
+    ASSERT_EQ(reg.Size<Mana>(), 66);
+    ASSERT_EQ(reg.Size<Stamina>(), 0);
+    ASSERT_EQ(query.Entities.Size(), 0u);
+    for (auto et : batch) {
+        ASSERT_FALSE(reg.Exists(et));
+    }
+    // Identifiers are reused
+    ASSERT_EQ(reg.Create() % 3, 0u);
+}
+
+TEST(EntityRegistry, ChangesDuringForEach)
+{
+    indie::ecs::EntityManager<unsigned> reg{};
+
+    for (int i = 0; i < 10; ++i) {
+        auto et = reg.Create();
+        reg.Assign<Mana>(et, i);
+        reg.Assign<Stamina>(et, i);
+    }
+
+    int visited{0};
+    reg.ForEach<Mana>([&](const auto et, Mana &) {
+        reg.Delete<Mana>(et);
+        ++visited;
+    });
+    ASSERT_EQ(visited, 10);
+    ASSERT_EQ(reg.Size<Mana>(), 0);
+
+    visited = 0;
+    reg.ForEach<Stamina>([&](const auto et, Stamina &stamina) {
+        if (stamina.Value % 2 == 0) {
+            reg.Destroy(et);
+        }
+        ++visited;
+    });
+    ASSERT_EQ(visited, 10);
+    ASSERT_EQ(reg.Size(), 5);
+    ASSERT_EQ(reg.Size<Stamina>(), 5);
+    reg.ForEach<Stamina>([](const auto, const Stamina &stamina) {
+        ASSERT_EQ(stamina.Value % 2, 1);
+    });
 }
\ No newline at end of file
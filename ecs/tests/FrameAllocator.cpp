@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+#include <indie/ecs/FrameAllocator.hpp>
+#include <indie/ecs/System.hpp>
+
+using namespace indie::ecs;
+
+TEST(FrameArena, BumpAndReset)
+{
+    FrameArena arena{1024};
+
+    auto a = arena.allocate(10, 1);
+    auto b = arena.allocate(sizeof(double), alignof(double));
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(b) % alignof(double), 0);
+    ASSERT_GT(static_cast<std::byte *>(b), static_cast<std::byte *>(a));
+    ASSERT_GE(arena.Used(), 10 + sizeof(double));
+
+    // Overflowing adds a chunk, merged on reset
+    static_cast<void>(arena.allocate(4000, 64));
+    ASSERT_EQ(arena.Chunks(), 2);
+    auto peak = arena.Used();
+    arena.Reset();
+    ASSERT_EQ(arena.Used(), 0);
+    ASSERT_EQ(arena.Chunks(), 1);
+    ASSERT_GE(arena.Capacity(), peak);
+    ASSERT_EQ(arena.HighWater(), peak);
+
+    // Steady state: the same frame fits in the merged chunk
+    static_cast<void>(arena.allocate(10, 1));
+    static_cast<void>(arena.allocate(sizeof(double), alignof(double)));
+    static_cast<void>(arena.allocate(4000, 64));
+    ASSERT_EQ(arena.Chunks(), 1);
+}
+
+#if INDIE_ECS_ARENA_POISON
+TEST(FrameArena, Poisoning)
+{
+    FrameArena arena{256};
+
+    auto data = static_cast<unsigned char *>(arena.allocate(16, 1));
+    ASSERT_EQ(data[0], FrameArena::AllocatedByte);
+    data[0] = 42;
+    arena.Reset();
+    ASSERT_EQ(data[0], FrameArena::FreedByte);
+    ASSERT_EQ(data[15], FrameArena::FreedByte);
+}
+#endif
+
+TEST(FrameAllocator, PmrContainers)
+{
+    FrameAllocator frame{1024};
+
+    std::pmr::vector<int> values{frame.Resource()};
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+    ASSERT_GE(frame.Stats().Used, 100 * sizeof(int));
+    ASSERT_EQ(frame.Resource(), frame.Resource());
+
+    auto array = frame.Allocate<std::uint64_t>(8);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array) % alignof(std::uint64_t), 0);
+}
+
+TEST(FrameAllocator, ArenaPerThread)
+{
+    FrameAllocator frame{1024};
+    FrameArena *arenas[2];
+
+    static_cast<void>(frame.Allocate(100));
+    std::thread thread{[&] {
+        arenas[1] = frame.Resource();
+        static_cast<void>(frame.Allocate(300));
+    }};
+    thread.join();
+    arenas[0] = frame.Resource();
+
+    ASSERT_NE(arenas[0], arenas[1]);
+    auto stats = frame.Stats();
+    ASSERT_EQ(stats.Arenas, 2);
+    ASSERT_GE(stats.Used, 400);
+
+    // Another allocator on the same thread gets its own arena, coming back reuses the first one
+    FrameAllocator other{1024};
+    ASSERT_NE(other.Resource(), arenas[0]);
+    ASSERT_EQ(frame.Resource(), arenas[0]);
+    ASSERT_EQ(frame.Stats().Arenas, 2);
+
+    frame.Reset();
+    stats = frame.Stats();
+    ASSERT_EQ(stats.Used, 0);
+    ASSERT_GE(stats.HighWater, 300);
+}
+
+namespace
+{
+    struct Cell
+    {
+        int x;
+    };
+
+    class NeighborsSystem : public System<Reads<Cell>>
+    {
+    public:
+        void Update() override
+        {
+            std::pmr::vector<Entity> neighbors{_frame->Resource()};
+            _em->ForEach<Cell>([&](auto et, Cell &) {
+                neighbors.push_back(et);
+            });
+            found = neighbors.size();
+        }
+
+        std::size_t found{0};
+    };
+}
+
+TEST(FrameAllocator, ResetAfterUpdate)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    for (int i = 0; i < 1000; ++i) {
+        em.Assign<Cell>(em.Create(), Cell{i});
+    }
+    auto system = sm.Add<NeighborsSystem>();
+
+    for (int i = 0; i < 3; ++i) {
+        sm.Update();
+    }
+    ASSERT_EQ(system->found, 1000);
+
+    auto stats = sm.GetFrameAllocator().Stats();
+    ASSERT_EQ(stats.Used, 0);
+    ASSERT_GE(stats.HighWater, 1000 * sizeof(Entity));
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <indie/ecs/details/HashedSparseSet.hpp>
+#include <indie/ecs/Pool.hpp>
+
+TEST(HashedSparseSet, 64BitsElements)
+{
+    indie::ecs::details::HashedSparseSet<std::uint64_t> ss;
+
+    ASSERT_TRUE(ss.IsEmpty());
+    ASSERT_FALSE(ss.Has(0));
+
+    ss.Insert(5);
+    ss.Insert(0xFFFFFFFFFFFFFFFFULL);
+    ss.Insert(0x8000000000000000ULL);
+    ss.Insert(340);
+    ss.Insert(7);
+    ss.Insert(0x0123456789ABCDEFULL);
+    ss.Insert(7);
+
+    ASSERT_FALSE(ss.IsEmpty());
+    ASSERT_EQ(ss.Size(), 6);
+    ASSERT_TRUE(ss.Has(0xFFFFFFFFFFFFFFFFULL));
+    ASSERT_TRUE(ss.Has(7));
+    ASSERT_FALSE(ss.Has(8));
+
+    ss.Erase(7);
+    ASSERT_EQ(ss.Size(), 5);
+    ASSERT_FALSE(ss.Has(7));
+
+    auto elements_nb = 0;
+
+    for (auto it = ss.Begin(); it != ss.End(); ++it) {
+        ASSERT_TRUE(ss.Has(*it));
+        ASSERT_EQ(*(ss.Begin() + ss.IndexOf(*it)), *it);
+        if (*it == 340) {
+            ss.Erase(it);
+        }
+        ++elements_nb;
+    }
+    ASSERT_EQ(elements_nb, ss.Size());
+    ASSERT_FALSE(ss.Has(340));
+
+    ss.Clear();
+    ASSERT_TRUE(ss.IsEmpty());
+    ASSERT_FALSE(ss.Has(5));
+}
+
+TEST(HashedSparseSet, GrowAndChurn)
+{
+    indie::ecs::details::HashedSparseSet<std::uint64_t> ss;
+    std::vector<std::uint64_t> keys;
+
+    for (std::uint64_t i = 0; i < 10000; ++i) {
+        keys.push_back(i * 0x9E3779B97F4A7C15ULL);
+        ss.Insert(keys.back());
+    }
+    ASSERT_EQ(ss.Size(), keys.size());
+    ASSERT_GE(ss.Capacity(), ss.Size());
+
+    // Erases and inserts repeatedly to fill the table with tombstones
+    for (int round = 0; round < 10; ++round) {
+        for (std::size_t i = 0; i < keys.size(); i += 2) {
+            ss.Erase(keys[i]);
+        }
+        for (std::size_t i = 0; i < keys.size(); i += 2) {
+            ASSERT_FALSE(ss.Has(keys[i]));
+            ss.Insert(keys[i]);
+        }
+    }
+    ASSERT_EQ(ss.Size(), keys.size());
+    for (auto key : keys) {
+        ASSERT_TRUE(ss.Has(key));
+        ASSERT_EQ(*(ss.Begin() + ss.IndexOf(key)), key);
+    }
+}
+
+struct PlayerInfo
+{
+    PlayerInfo() = default;
+    explicit PlayerInfo(int score) : Score(score) {}
+    int Score{0};
+};
+
+TEST(HashedPool, NetworkIds)
+{
+    indie::ecs::HashedPool<PlayerInfo> pool;
+    std::uint64_t id1 = 0xDEADBEEF00000001ULL;
+    std::uint64_t id2 = 0x0000000100000000ULL;
+    std::uint64_t id3 = 42;
+
+    pool.Assign(id1, 10);
+    pool.Assign(id2, 20);
+    pool.Assign(id3, 30);
+    ASSERT_EQ(pool.Size(), 3);
+    ASSERT_EQ(pool.Get(id2)->Score, 20);
+
+    pool.Delete(id1);
+    ASSERT_EQ(pool.Get(id1), nullptr);
+    ASSERT_EQ(pool.Get(id2)->Score, 20);
+    ASSERT_EQ(pool.Get(id3)->Score, 30);
+
+    pool.AssignOrReplace(id1, 11);
+    ASSERT_EQ(pool.Get(id1)->Score, 11);
+    ASSERT_EQ(pool.Size(), 3);
+
+    auto total = 0;
+    pool.ForEach([&](const auto, const PlayerInfo &info) {
+        total += info.Score;
+    });
+    ASSERT_EQ(total, 61);
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <indie/ecs/Hierarchy.hpp>
+
+struct Transform
+{
+    Transform() = default;
+    explicit Transform(int local) : Local(local) {}
+    int Local{0};
+    int World{0};
+};
+
+TEST(Hierarchy, AttachDetach)
+{
+    indie::ecs::EntityManager<unsigned> reg;
+    indie::ecs::Hierarchy<unsigned> hierarchy{reg};
+
+    auto player = reg.Create();
+    auto bomb = reg.Create();
+    auto fuse = reg.Create();
+    auto spark = reg.Create();
+
+    hierarchy.Attach(fuse, bomb);
+    hierarchy.Attach(spark, bomb);
+    hierarchy.Attach(bomb, player);
+
+    ASSERT_EQ(hierarchy.Parent(bomb), player);
+    ASSERT_EQ(hierarchy.Parent(player), hierarchy.Null);
+    ASSERT_EQ(hierarchy.Children(bomb), 2);
+    ASSERT_EQ(hierarchy.Depth(player), 0);
+    ASSERT_EQ(hierarchy.Depth(bomb), 1);
+    ASSERT_EQ(hierarchy.Depth(fuse), 2);
+    ASSERT_EQ(hierarchy.Depth(spark), 2);
+
+    std::vector<unsigned> children;
+    hierarchy.ForEachChild(bomb, [&](const auto child) {
+        children.push_back(child);
+    });
+    ASSERT_EQ(children.size(), 2);
+
+    // Dropping the bomb makes it a root
+    hierarchy.Detach(bomb);
+    ASSERT_EQ(hierarchy.Parent(bomb), hierarchy.Null);
+    ASSERT_EQ(hierarchy.Children(player), 0);
+    ASSERT_EQ(hierarchy.Depth(fuse), 1);
+
+    // Moves the spark from the bomb to the player
+    hierarchy.Attach(spark, player);
+    ASSERT_EQ(hierarchy.Children(bomb), 1);
+    ASSERT_EQ(hierarchy.Children(player), 1);
+    ASSERT_EQ(hierarchy.Depth(spark), 1);
+}
+
+TEST(Hierarchy, DepthOrderedPropagation)
+{
+    indie::ecs::EntityManager<unsigned> reg;
+    indie::ecs::Hierarchy<unsigned> hierarchy{reg};
+    std::vector<unsigned> chain;
+
+    // Children are created before their parents to scramble the storage order
+    for (int i = 0; i < 8; ++i) {
+        chain.push_back(reg.Create());
+        reg.Assign<Transform>(chain.back(), 1);
+    }
+    for (std::size_t i = chain.size() - 1; i > 0; --i) {
+        hierarchy.Attach(chain[i - 1], chain[i]);
+    }
+
+    std::size_t prev_depth{0};
+    hierarchy.ForEach([&](const auto et, const auto &link) {
+        ASSERT_LE(prev_depth, link.Depth);
+        prev_depth = link.Depth;
+
+        auto transform = reg.Get<Transform>(et);
+        transform->World = transform->Local;
+        if (link.Parent != hierarchy.Null) {
+            transform->World += reg.Get<Transform>(link.Parent)->World;
+        }
+    });
+    ASSERT_EQ(reg.Get<Transform>(chain.front())->World, 8);
+}
+
+TEST(Hierarchy, DestroySubtree)
+{
+    indie::ecs::EntityManager<unsigned> reg;
+    indie::ecs::Hierarchy<unsigned> hierarchy{reg};
+
+    auto player = reg.Create();
+    auto bomb = reg.Create();
+    auto fuse = reg.Create();
+    auto particle = reg.Create();
+    auto other = reg.Create();
+
+    reg.Assign<Transform>(fuse);
+    hierarchy.Attach(bomb, player);
+    hierarchy.Attach(other, player);
+    hierarchy.Attach(fuse, bomb);
+    hierarchy.Attach(particle, fuse);
+
+    hierarchy.Destroy(bomb);
+    ASSERT_TRUE(reg.Exists(player));
+    ASSERT_TRUE(reg.Exists(other));
+    ASSERT_FALSE(reg.Exists(bomb));
+    ASSERT_FALSE(reg.Exists(fuse));
+    ASSERT_FALSE(reg.Exists(particle));
+    ASSERT_EQ(reg.Size<Transform>(), 0);
+    ASSERT_EQ(hierarchy.Children(player), 1);
+    ASSERT_EQ(reg.Size<indie::ecs::Relationship<unsigned>>(), 2);
+
+    hierarchy.Destroy(player);
+    ASSERT_EQ(reg.Size(), 0);
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+#include <numeric>
+#include <stdexcept>
+
+#include <indie/ecs/JobSystem.hpp>
+#include <indie/ecs/System.hpp>
+
+using namespace indie::ecs;
+
+TEST(JobSystem, RunsEveryJobOnce)
+{
+    for (std::size_t workers : {0, 1, 3}) {
+        JobSystem jobs{workers};
+        std::vector<std::atomic<int>> runs(1000);
+        JobCounter counter;
+
+        jobs.Spawn(counter, runs.size(), [&runs](std::size_t i) {
+            ++runs[i];
+        });
+        jobs.Wait(counter);
+
+        ASSERT_TRUE(counter.IsDone());
+        for (auto &run : runs) {
+            ASSERT_EQ(run, 1);
+        }
+    }
+}
+
+TEST(JobSystem, ExceptionsReachWait)
+{
+    for (std::size_t workers : {0, 1, 3}) {
+        JobSystem jobs{workers};
+        std::atomic<int> runs{0};
+        JobCounter counter;
+
+        jobs.Spawn(counter, 100, [&runs](std::size_t i) {
+            ++runs;
+            if (i % 40 == 7) {
+                throw std::runtime_error{"job failed"};
+            }
+        });
+        ASSERT_THROW(jobs.Wait(counter), std::runtime_error);
+        // The other jobs still ran
+        ASSERT_TRUE(counter.IsDone());
+        ASSERT_EQ(runs, 100);
+
+        jobs.Spawn(counter, 10, [&runs](std::size_t) {
+            ++runs;
+        });
+        ASSERT_NO_THROW(jobs.Wait(counter));
+        ASSERT_EQ(runs, 110);
+    }
+}
+
+namespace
+{
+    struct Sum
+    {
+        JobSystem *Jobs;
+        const int *Values;
+        std::size_t Count;
+        long *Result;
+
+        // Splits the range in two jobs and waits for them
+        void operator()() const
+        {
+            if (Count <= 64) {
+                *Result = std::accumulate(Values, Values + Count, 0L);
+                return;
+            }
+
+            long left{0};
+            long right{0};
+            JobCounter counter;
+            auto half = Count / 2;
+
+            Jobs->Spawn(counter, Sum{Jobs, Values, half, &left});
+            Jobs->Spawn(counter, Sum{Jobs, Values + half, Count - half, &right});
+            Jobs->Wait(counter);
+            *Result = left + right;
+        }
+    };
+}
+
+TEST(JobSystem, NestedWaits)
+{
+    JobSystem jobs{3};
+    std::vector<int> values(100000);
+    std::iota(values.begin(), values.end(), 0);
+
+    long result{0};
+    JobCounter counter;
+    jobs.Spawn(counter, Sum{&jobs, values.data(), values.size(), &result});
+    jobs.Wait(counter);
+
+    ASSERT_EQ(result, 4999950000L);
+}
+
+namespace
+{
+    struct Path
+    {
+        int length;
+    };
+
+    class PathfindingSystem : public System<Writes<Path>, Query<Path>>
+    {
+    public:
+        void Update() override
+        {
+            auto &paths = _em->Storage<Path>();
+            auto &entities = _query->Entities;
+            JobCounter counter;
+
+            // One job per batch of 16 entities
+            _jobs->Spawn(counter, (entities.Size() + 15) / 16, [&paths, &entities](std::size_t batch) {
+                auto end = std::min(entities.Size(), (batch + 1) * 16);
+                for (auto i = batch * 16; i < end; ++i) {
+                    paths.Get(*(entities.Begin() + i))->length += 1;
+                }
+            });
+            _jobs->Wait(counter);
+        }
+    };
+
+    class CountSystem : public System<Reads<Path>>
+    {
+    public:
+        void Update() override
+        {
+            total = 0;
+            _em->ForEach<Path>([this](auto, Path &path) {
+                total += path.length;
+            });
+        }
+
+        long total{0};
+    };
+
+    class FailingPathSystem : public System<Reads<Path>>
+    {
+    public:
+        void Update() override
+        {
+            throw std::runtime_error{"system failed"};
+        }
+    };
+}
+
+TEST(JobSystem, SystemJobs)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em, 2};
+
+    for (int i = 0; i < 1000; ++i) {
+        em.Assign<Path>(em.Create(), Path{0});
+    }
+    sm.Add<PathfindingSystem>();
+    auto count = sm.Add<CountSystem>();
+
+    for (int i = 0; i < 10; ++i) {
+        sm.Update();
+    }
+    // The reader runs after the writer, in a later stage
+    ASSERT_EQ(count->total, 10 * 1000);
+}
+
+TEST(JobSystem, SystemExceptions)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em, 2};
+
+    em.Assign<Path>(em.Create(), Path{0});
+    sm.Add<CountSystem>();
+    sm.Add<FailingPathSystem>();
+    ASSERT_EQ(sm.Stages(), 1u);
+
+    // Both readers share a stage and run as jobs, the exception reaches the caller
+    ASSERT_THROW(sm.Update(), std::runtime_error);
+}
\ No newline at end of file
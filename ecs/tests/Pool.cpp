@@ -91,4 +91,29 @@ TEST(ManaComponent, 3Entities)
 
     pool.Reset();
     ASSERT_EQ(pool.Size(), 0);
+}
+
+TEST(ManaComponent, Sort)
+{
+    indie::ecs::Pool<ManaComponent> pool;
+
+    pool.Assign(4, 40);
+    pool.Assign(1, 10);
+    pool.Assign(3, 30);
+    pool.Assign(0, 0);
+    pool.Assign(2, 20);
+    pool.Delete(3);
+
+    pool.Sort([](const ManaComponent &lhs, const ManaComponent &rhs) {
+        return lhs.Mana < rhs.Mana;
+    });
+
+    int prev{-1};
+    pool.ForEach([&](const auto et, const ManaComponent &comp) {
+        ASSERT_LT(prev, comp.Mana);
+        ASSERT_EQ(comp.Mana, static_cast<int>(et) * 10);
+        prev = comp.Mana;
+    });
+    ASSERT_EQ(pool.Get(4)->Mana, 40);
+    ASSERT_FALSE(pool.Has(3));
 }
\ No newline at end of file
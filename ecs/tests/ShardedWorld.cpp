@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include <indie/ecs/ShardedWorld.hpp>
+
+struct Position
+{
+    Position() = default;
+    explicit Position(float x) : X(x) {}
+    float X{0};
+};
+
+struct Speed
+{
+    Speed() = default;
+    explicit Speed(float value) : Value(value) {}
+    float Value{0};
+};
+
+using World = indie::ecs::ShardedWorld<indie::meta::TypeList<Position, Speed>>;
+
+class MoveSystem : public indie::ecs::System<>
+{
+public:
+    MoveSystem(World::Shard &shard, indie::ecs::StripPartition partition) :
+        _shard(shard), _partition(partition)
+    {}
+
+    virtual void Update() final
+    {
+        _leaving.clear();
+        _em->ForEach<Position, Speed>([&](const auto et, Position &pos, const Speed &speed) {
+            pos.X += speed.Value;
+            if (_partition(pos.X) != _shard.Id()) {
+                _leaving.push_back(et);
+            }
+        });
+        for (auto et : _leaving) {
+            _shard.Migrate(et, _partition(_em->Get<Position>(et)->X));
+        }
+    }
+
+private:
+    World::Shard &_shard;
+    indie::ecs::StripPartition _partition;
+    std::vector<indie::ecs::Entity> _leaving;
+};
+
+class ThrowingShardSystem : public indie::ecs::System<>
+{
+public:
+    ThrowingShardSystem(std::size_t &ticks, bool throws) :
+        _ticks(ticks), _throws(throws)
+    {}
+
+    virtual void Update() final
+    {
+        ++_ticks;
+        if (std::exchange(_throws, false)) {
+            throw std::runtime_error("shard failed");
+        }
+    }
+
+private:
+    std::size_t &_ticks;
+    bool _throws;
+};
+
+TEST(ShardedWorld, UniqueHandles)
+{
+    World world{4};
+    std::set<World::Handle> handles;
+
+    for (std::size_t i = 0; i < 40; ++i) {
+        auto handle = world.Create(i % world.Shards());
+        ASSERT_EQ(World::ShardOf(handle), i % world.Shards());
+        ASSERT_TRUE(world.GetShard(World::ShardOf(handle)).Entities().Exists(World::LocalOf(handle)));
+        handles.insert(handle);
+    }
+    ASSERT_EQ(handles.size(), 40);
+    ASSERT_EQ(world.Size(), 40);
+}
+
+TEST(ShardedWorld, Migration)
+{
+    indie::ecs::StripPartition partition{0.0f, 40.0f, 4};
+    World world{partition.Count};
+
+    world.ForEachShard([&](auto &shard) {
+        shard.Systems().template Add<MoveSystem>(shard, partition);
+    });
+
+    // Every agent starts in the first strip and walks to the right
+    for (int i = 0; i < 100; ++i) {
+        auto handle = world.Create(0);
+        auto &em = world.GetShard(0).Entities();
+        em.Assign<Position>(World::LocalOf(handle), 0.5f);
+        em.Assign<Speed>(World::LocalOf(handle), 1.0f + (i % 3));
+    }
+
+    for (int tick = 0; tick < 30; ++tick) {
+        world.Update();
+    }
+    // Entities sent during the last tick are received by the next one
+    world.Update();
+
+    ASSERT_EQ(world.Size(), 100);
+    world.ForEachShard([&](auto &shard) {
+        shard.Entities().template ForEach<Position>([&](const auto, const Position &pos) {
+            ASSERT_EQ(partition(pos.X), shard.Id());
+        });
+        ASSERT_EQ(shard.Entities().template Size<Position>(), shard.Entities().template Size<Speed>());
+    });
+    ASSERT_EQ(world.GetShard(0).Entities().Size(), 0);
+    ASSERT_EQ(world.GetShard(3).Entities().Size(), 100);
+}
+
+TEST(ShardedWorld, StaleHandles)
+{
+    World world{2};
+
+    auto first = world.Create(0);
+    world.Destroy(first);
+    ASSERT_FALSE(world.Alive(first));
+
+    // The local identifier is reused, not the handle
+    auto second = world.Create(0);
+    ASSERT_EQ(World::LocalOf(second), World::LocalOf(first));
+    ASSERT_NE(second, first);
+    ASSERT_TRUE(world.Alive(second));
+    world.Destroy(first);
+    ASSERT_TRUE(world.Alive(second));
+
+    // The destination reports the new handle when it receives the entity
+    auto &source = world.GetShard(0);
+    source.Entities().Assign<Position>(World::LocalOf(second), 3.0f);
+    source.Migrate(World::LocalOf(second), 1);
+    ASSERT_FALSE(world.Alive(second));
+    world.Update();
+
+    auto &arrivals = world.GetShard(1).Arrivals();
+    ASSERT_EQ(arrivals.size(), 1u);
+    ASSERT_EQ(arrivals[0].From, second);
+    ASSERT_EQ(World::ShardOf(arrivals[0].To), 1u);
+    ASSERT_TRUE(world.Alive(arrivals[0].To));
+    ASSERT_EQ(world.GetShard(1).Entities().Get<Position>(World::LocalOf(arrivals[0].To))->X, 3.0f);
+
+    world.Update();
+    ASSERT_TRUE(world.GetShard(1).Arrivals().empty());
+}
+
+TEST(ShardedWorld, ShardExceptions)
+{
+    World world{3};
+    std::vector<std::size_t> ticks(world.Shards(), 0);
+
+    world.ForEachShard([&](auto &shard) {
+        shard.Systems().template Add<ThrowingShardSystem>(ticks[shard.Id()], shard.Id() == 1);
+    });
+
+    // The other shards complete their tick before the exception reaches Update
+    ASSERT_THROW(world.Update(), std::runtime_error);
+    ASSERT_EQ(ticks, std::vector<std::size_t>(world.Shards(), 1));
+
+    world.Update();
+    ASSERT_EQ(ticks, std::vector<std::size_t>(world.Shards(), 2));
+}
\ No newline at end of file
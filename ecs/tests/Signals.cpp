@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+
+#include <indie/ecs/EntityManager.hpp>
+
+using indie::ecs::Entity;
+
+struct Armor
+{
+    int Value{0};
+};
+
+struct Sprite
+{
+    int Value{0};
+};
+
+struct Sound
+{
+    int Value{0};
+};
+
+/**
+ * @brief Records signals, and what the entity still owns when they arrive.
+ *
+ */
+struct SignalLog
+{
+    template <typename Component>
+    void Check(const char *name, Entity et, Component *component)
+    {
+        entries.push_back(std::string{name} + (component ? ":" + std::to_string(component->Value) : ""));
+        still.push_back(em->Has<Armor>(et) + em->Has<Sprite>(et) + em->Has<Sound>(et));
+    }
+
+    void OnReceive(indie::ecs::Assigned<Armor> &args)
+    {
+        Check("+armor", args.Entity, em->Get<Armor>(args.Entity));
+    }
+
+    void OnReceive(indie::ecs::Replaced<Armor> &args)
+    {
+        Check("=armor", args.Entity, em->Get<Armor>(args.Entity));
+    }
+
+    void OnReceive(indie::ecs::Deleted<Armor> &args)
+    {
+        Check("-armor", args.Entity, em->Get<Armor>(args.Entity));
+    }
+
+    void OnReceive(indie::ecs::Deleted<Sprite> &args)
+    {
+        Check("-sprite", args.Entity, em->Get<Sprite>(args.Entity));
+    }
+
+    void OnReceive(indie::ecs::Deleted<Sound> &args)
+    {
+        Check("-sound", args.Entity, em->Get<Sound>(args.Entity));
+    }
+
+    void OnReceive(indie::ecs::Destroyed<> &args)
+    {
+        entries.push_back("destroyed");
+        still.push_back(em->Exists(args.Entity) ? 1 : 0);
+    }
+
+    indie::ecs::EntityManager<> *em;
+    std::vector<std::string> entries;
+    std::vector<int> still;
+};
+
+TEST(Signals, Immediate)
+{
+    indie::ecs::EntityManager<> em;
+    indie::event::EventManager events;
+    SignalLog log{&em, {}, {}};
+
+    events.Register<indie::ecs::Assigned<Armor>, indie::ecs::Replaced<Armor>, indie::ecs::Deleted<Armor>>(log);
+
+    // Not connected, nothing is sent
+    auto et = em.Create();
+    em.Assign<Armor>(et, Armor{1});
+    em.Delete<Armor>(et);
+    ASSERT_TRUE(log.entries.empty());
+
+    em.Connect<Armor>(events);
+    em.Assign<Armor>(et, Armor{2});
+    em.Replace<Armor>(et, Armor{3});
+    em.AssignOrReplace<Armor>(et, Armor{4});
+    em.Delete<Armor>(et);
+    ASSERT_EQ(log.entries, std::vector<std::string>({"+armor:2", "=armor:3", "=armor:4", "-armor:4"}));
+
+    em.Disconnect<Armor>();
+    em.Assign<Armor>(et, Armor{5});
+    ASSERT_EQ(log.entries.size(), 4u);
+}
+
+TEST(Signals, DestroyOrder)
+{
+    indie::ecs::EntityManager<> em;
+    indie::event::EventManager events;
+    SignalLog log{&em, {}, {}};
+
+    events.Register<indie::ecs::Deleted<Armor>, indie::ecs::Deleted<Sprite>, indie::ecs::Deleted<Sound>, indie::ecs::Destroyed<>>(log);
+    em.Connect<Armor, Sprite, Sound>(events);
+    em.ConnectDestroyed(events);
+
+    auto et = em.Create();
+    em.Assign<Armor>(et, Armor{1});
+    em.Assign<Sprite>(et, Sprite{2});
+    em.Assign<Sound>(et, Sound{3});
+    em.Destroy(et);
+
+    // Each component is readable by its signal, every signal comes before `Destroyed`
+    ASSERT_EQ(log.entries.size(), 4u);
+    ASSERT_EQ(log.entries.back(), "destroyed");
+    ASSERT_EQ(log.still, std::vector<int>({3, 2, 1, 0}));
+    for (auto name : {"-armor:1", "-sprite:2", "-sound:3"}) {
+        ASSERT_NE(std::find(log.entries.begin(), log.entries.end(), name), log.entries.end());
+    }
+
+    // Bulk reset sends the same signals
+    log.entries.clear();
+    log.still.clear();
+    for (int i = 0; i < 3; ++i) {
+        auto other = em.Create();
+        em.Assign<Sprite>(other, Sprite{i});
+    }
+    em.Reset<Sprite>();
+    ASSERT_EQ(log.entries, std::vector<std::string>({"-sprite:2", "-sprite:1", "-sprite:0"}));
+    em.Reset();
+    ASSERT_EQ(log.entries.size(), 6u);
+    ASSERT_EQ(em.Size(), 0u);
+}
+
+/**
+ * @brief Destroys the entity losing its armor, refuses to lose sounds.
+ *
+ */
+struct Destroyer
+{
+    void OnReceive(indie::ecs::Deleted<Armor> &args)
+    {
+        // Destroying the entity deletes its armor again
+        if (!destroying) {
+            destroying = true;
+            em->Destroy(args.Entity);
+        }
+    }
+
+    void OnReceive(indie::ecs::Deleted<Sound> &)
+    {
+        throw std::runtime_error{"sound still playing"};
+    }
+
+    indie::ecs::EntityManager<> *em;
+    bool destroying{false};
+};
+
+TEST(Signals, ObserversChangingTheEntity)
+{
+    indie::ecs::EntityManager<> em;
+    indie::event::EventManager events;
+    SignalLog log{&em, {}, {}};
+    Destroyer destroyer{&em, false};
+
+    events.Register<indie::ecs::Deleted<Armor>, indie::ecs::Deleted<Sound>>(destroyer);
+    events.Register<indie::ecs::Deleted<Sprite>, indie::ecs::Destroyed<>>(log);
+    em.Connect<Armor, Sprite, Sound>(events);
+    em.ConnectDestroyed(events);
+
+    // The entity is destroyed before its sprite is deleted, the sprite is not deleted twice
+    auto et = em.Create();
+    em.Assign<Armor>(et);
+    em.Assign<Sprite>(et, Sprite{1});
+    em.Delete<Armor, Sprite>(et);
+    ASSERT_FALSE(em.Exists(et));
+    ASSERT_EQ(log.entries, std::vector<std::string>({"-sprite:1", "destroyed"}));
+
+    // Exceptions of immediate observers reach the caller, the component is kept
+    auto other = em.Create();
+    em.Assign<Sound>(other);
+    ASSERT_THROW(em.Delete<Sound>(other), std::runtime_error);
+    ASSERT_TRUE(em.Has<Sound>(other));
+    ASSERT_THROW(em.Reset(), std::runtime_error);
+}
+
+/**
+ * @brief Counts queued signals, by batch.
+ *
+ */
+struct SpriteNodes
+{
+    void OnReceive(indie::event::Span<indie::ecs::Assigned<Sprite>> events)
+    {
+        for (auto &args : events) {
+            created.push_back(args.Entity);
+        }
+    }
+
+    void OnReceive(indie::event::Span<indie::ecs::Deleted<Sprite>> events)
+    {
+        for (auto &args : events) {
+            removed.push_back(args.Entity);
+        }
+    }
+
+    std::vector<Entity> created;
+    std::vector<Entity> removed;
+};
+
+TEST(Signals, Queued)
+{
+    indie::ecs::EntityManager<> em;
+    indie::event::EventManager events;
+    SpriteNodes nodes;
+
+    events.Register<indie::ecs::Assigned<Sprite>, indie::ecs::Deleted<Sprite>>(nodes);
+    em.Connect<Sprite>(events, indie::ecs::SignalMode::Queued);
+
+    std::vector<Entity> entities;
+    for (int i = 0; i < 4; ++i) {
+        entities.push_back(em.Create());
+        em.Assign<Sprite>(entities.back());
+    }
+    em.Destroy(entities[1], entities[3]);
+    ASSERT_TRUE(nodes.created.empty());
+
+    // Order is kept within a signal type
+    events.Dispatch();
+    ASSERT_EQ(nodes.created, entities);
+    ASSERT_EQ(nodes.removed, std::vector<Entity>({entities[1], entities[3]}));
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <indie/ecs/StaticSystemManager.hpp>
+
+namespace
+{
+    struct Position
+    {
+        float x;
+    };
+
+    struct Velocity
+    {
+        float x;
+    };
+
+    using namespace indie::ecs;
+
+    std::vector<int> order;
+
+    class MoveSystem : public System<Writes<Position>, Reads<Velocity>, Query<Position, Velocity>>
+    {
+    public:
+        void Update() override
+        {
+            order.push_back(1);
+            for (auto et : _query->Entities) {
+                _em->Get<Position>(et)->x += _em->Get<Velocity>(et)->x;
+            }
+        }
+    };
+
+    class InputSystem : public System<InPhase<Phase::Input>>
+    {
+    public:
+        void Update() override
+        {
+            order.push_back(0);
+        }
+    };
+
+    class RenderSystem : public System<Reads<Position>, InPhase<Phase::Render>>
+    {
+    public:
+        void Update() override
+        {
+            order.push_back(2);
+            alpha = _time->Alpha;
+            ticks = _time->Tick;
+        }
+
+        double alpha{1.0};
+        std::uint64_t ticks{0};
+    };
+
+    class SleepSystem : public System<Reads<Position>>
+    {
+    public:
+        void Update() override
+        {
+            order.push_back(3);
+            Deactivate();
+        }
+    };
+
+    using Manager = StaticSystemManager<RenderSystem, MoveSystem, SleepSystem, InputSystem>;
+}
+
+TEST(StaticSystemManager, PhasesAndActivation)
+{
+    EntityManager<> em;
+    Manager sm{em};
+
+    static_assert(Manager::Has<MoveSystem>());
+    static_assert(!Manager::Has<System<>>());
+    static_assert(Manager::Size == 4);
+
+    order.clear();
+
+    // Empty query
+    sm.Update();
+    EXPECT_EQ(order, std::vector<int>({0, 3, 2}));
+    EXPECT_FALSE(sm.IsActive<SleepSystem>());
+    EXPECT_FALSE(sm.Get<SleepSystem>().IsActive());
+
+    auto et = em.Create();
+    em.Assign<Position>(et, Position{0});
+    em.Assign<Velocity>(et, Velocity{2});
+    sm.Deactivate<InputSystem>();
+    sm.Get<SleepSystem>().Activate();
+    order.clear();
+    sm.Update();
+    EXPECT_EQ(order, std::vector<int>({1, 3, 2}));
+    EXPECT_FLOAT_EQ(em.Get<Position>(et)->x, 2);
+
+    sm.Activate<InputSystem>();
+    order.clear();
+    sm.Update();
+    EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+    EXPECT_EQ(sm.Get<RenderSystem>().ticks, 3u);
+    EXPECT_EQ(sm.Get<RenderSystem>().alpha, 0.0);
+    EXPECT_EQ(sm.Time().Frame, 3u);
+}
\ No newline at end of file
@@ -1,4 +1,925 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <sstream>
+#include <random>
+#include <vector>
+
 #include <indie/ecs/System.hpp>
 
+namespace
+{
+    struct Position
+    {
+        float x;
+    };
+
+    struct Velocity
+    {
+        float x;
+    };
+
+    struct Health
+    {
+        int value;
+    };
+
+    using namespace indie::ecs;
+
+    class MoveSystem : public System<Reads<Velocity>, Writes<Position>>
+    {
+    public:
+        void Update() override
+        {
+            _em->ForEach<Position, Velocity>([](auto, Position &pos, Velocity &vel) {
+                pos.x += vel.x;
+            });
+        }
+    };
+
+    class RegenSystem : public System<Writes<Health>>
+    {
+    public:
+        void Update() override
+        {
+            _em->ForEach<Health>([](auto, Health &health) {
+                health.value += 1;
+            });
+        }
+    };
+
+    class DragSystem : public System<Writes<Velocity>>
+    {
+    public:
+        void Update() override
+        {
+            _em->ForEach<Velocity>([](auto, Velocity &vel) {
+                vel.x *= 0.5f;
+            });
+        }
+    };
+
+    class RenderSystem : public System<Reads<Position, Health>>
+    {
+    public:
+        void Update() override
+        {
+            sum = 0;
+            _em->ForEach<Position, Health>([this](auto, Position &pos, Health &health) {
+                sum += pos.x + static_cast<float>(health.value);
+            });
+        }
+
+        float sum{0};
+    };
+
+    class SpawnSystem : public System<Structural>
+    {
+    public:
+        void Update() override
+        {
+            auto et = _em->Create();
+            _em->Assign<Position>(et, Position{0});
+            _em->Assign<Velocity>(et, Velocity{1});
+            _em->Assign<Health>(et, Health{0});
+        }
+    };
+
+    class LegacySystem : public System<>
+    {
+    public:
+        void Update() override
+        {}
+    };
+
+    template <typename Manager>
+    void Register(Manager &sm)
+    {
+        sm.template Add<SpawnSystem>();
+        sm.template Add<MoveSystem>();
+        sm.template Add<RegenSystem>();
+        sm.template Add<DragSystem>();
+        sm.template Add<RenderSystem>();
+    }
+}
+
+TEST(SystemManager, Stages)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    Register(sm);
+    sm.Add<LegacySystem>();
+
+    // Registration order: Spawn, Move, Regen, Drag, Render, Legacy
+    EXPECT_EQ(sm.StageOf<SpawnSystem>(), 0);
+    // Move and Regen do not conflict, they share a stage after the structural sync point
+    EXPECT_EQ(sm.StageOf<MoveSystem>(), 1);
+    EXPECT_EQ(sm.StageOf<RegenSystem>(), 1);
+    // Drag writes what Move reads
+    EXPECT_EQ(sm.StageOf<DragSystem>(), 2);
+    // Render reads what Move and Regen write, but not Velocity
+    EXPECT_EQ(sm.StageOf<RenderSystem>(), 2);
+    // Undeclared systems run alone
+    EXPECT_EQ(sm.StageOf<LegacySystem>(), 3);
+    EXPECT_EQ(sm.Stages(), 4);
+}
+
+TEST(SystemManager, ParallelMatchesSerial)
+{
+    EntityManager<> serial_em;
+    EntityManager<> parallel_em;
+    SystemManager<> serial{serial_em};
+    SystemManager<> parallel{parallel_em, 4};
+
+    Register(serial);
+    Register(parallel);
+
+    for (int i = 0; i < 50; ++i) {
+        serial.Update();
+        parallel.Update();
+    }
+
+    ASSERT_EQ(serial_em.Size(), 50);
+    ASSERT_EQ(parallel_em.Size(), 50);
+    serial_em.ForEach<Position, Velocity, Health>([&](auto et, Position &pos, Velocity &vel, Health &health) {
+        EXPECT_FLOAT_EQ(parallel_em.Get<Position>(et)->x, pos.x);
+        EXPECT_FLOAT_EQ(parallel_em.Get<Velocity>(et)->x, vel.x);
+        EXPECT_EQ(parallel_em.Get<Health>(et)->value, health.value);
+    });
+}
+
+namespace
+{
+    std::atomic<int> running{0};
+    std::atomic<int> overlaps{0};
+
+    template <int N>
+    class ProbeSystem : public System<Structural>
+    {
+    public:
+        void Update() override
+        {
+            if (running++ != 0) {
+                ++overlaps;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            --running;
+        }
+    };
+}
+
+TEST(SystemManager, StructuralRunsAlone)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em, 4};
+
+    sm.Add<ProbeSystem<0>>();
+    sm.Add<ProbeSystem<1>>();
+    sm.Add<ProbeSystem<2>>();
+    sm.Add<ProbeSystem<3>>();
+
+    for (int i = 0; i < 10; ++i) {
+        sm.Update();
+    }
+    EXPECT_EQ(sm.Stages(), 4);
+    EXPECT_EQ(overlaps, 0);
+}
+
+TEST(SystemManager, Profiler)
+{
+    EntityManager<> em;
+    SystemManager<Entity, SystemProfiler> sm{em, 2};
+
+    Register(sm);
+    sm.Add<ProbeSystem<0>>();
+
+    for (int i = 0; i < 5; ++i) {
+        sm.Update();
+    }
+    sm.GetProfiler().Capture(3);
+    for (int i = 0; i < 10; ++i) {
+        sm.Update();
+    }
+
+    auto timings = sm.GetProfiler().Timings();
+    ASSERT_EQ(timings.size(), 6);
+    for (auto &timing : timings) {
+        EXPECT_EQ(timing.Samples, 15);
+        EXPECT_LE(timing.Min, timing.Avg);
+        EXPECT_LE(timing.Avg, timing.P99);
+    }
+    auto probe = std::find_if(timings.begin(), timings.end(), [](auto &timing) {
+        return timing.Name.find("ProbeSystem<0>") != std::string::npos;
+    });
+    ASSERT_NE(probe, timings.end());
+    EXPECT_GE(probe->Min, 200000);
+
+    std::ostringstream trace;
+    sm.GetProfiler().WriteChromeTrace(trace);
+    auto json = trace.str();
+    std::size_t events{0};
+    for (auto pos = json.find("\"ph\":\"X\""); pos != std::string::npos; pos = json.find("\"ph\":\"X\"", pos + 1)) {
+        ++events;
+    }
+    // 6 systems during 3 frames
+    EXPECT_EQ(events, 18);
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+}
+
+namespace
+{
+    struct Body
+    {
+        double x;
+        double v;
+    };
+
+    class PhysicsSystem : public System<Writes<Body>, InPhase<Phase::FixedUpdate>>
+    {
+    public:
+        void Update() override
+        {
+            auto dt = _time->FixedSeconds();
+            _em->ForEach<Body>([dt](auto, Body &body) {
+                body.v -= 9.81 * dt;
+                body.x += body.v * dt;
+            });
+        }
+    };
+
+    class InterpolationSystem : public System<Reads<Body>, InPhase<Phase::Render>>
+    {
+    public:
+        void Update() override
+        {
+            alphas.push_back(_time->Alpha);
+        }
+
+        std::vector<double> alphas;
+    };
+
+    std::vector<Phase> order;
+
+    template <Phase P>
+    class PhaseProbe : public System<InPhase<P>>
+    {
+    public:
+        void Update() override
+        {
+            order.push_back(P);
+        }
+    };
+
+    double Simulate(const std::vector<std::chrono::nanoseconds> &deltas, std::uint64_t &ticks)
+    {
+        EntityManager<> em;
+        SystemManager<> sm{em};
+
+        sm.SetTimestep(Timestep{std::chrono::milliseconds(10), 1000});
+        sm.Add<PhysicsSystem>();
+        em.Assign<Body>(em.Create(), Body{100.0, 0.0});
+        for (auto delta : deltas) {
+            sm.Update(delta);
+        }
+        ticks = sm.Time().Tick;
+        return em.Get<Body>(0)->x;
+    }
+}
+
+TEST(SystemManager, PhasesOrder)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    order.clear();
+    sm.Add<PhaseProbe<Phase::Render>>();
+    sm.Add<PhaseProbe<Phase::PostUpdate>>();
+    sm.Add<PhaseProbe<Phase::Update>>();
+    sm.Add<PhaseProbe<Phase::FixedUpdate>>();
+    sm.Add<PhaseProbe<Phase::Input>>();
+
+    // Phase-only declarations do not describe any access, each system runs alone in its phase
+    EXPECT_EQ(sm.Stages(), 5);
+
+    sm.Update(std::chrono::nanoseconds(0));
+    EXPECT_EQ(order, (std::vector<Phase>{Phase::Input, Phase::Update, Phase::PostUpdate, Phase::Render}));
+
+    order.clear();
+    sm.Update();
+    EXPECT_EQ(order, (std::vector<Phase>{Phase::Input, Phase::FixedUpdate, Phase::Update, Phase::PostUpdate, Phase::Render}));
+}
+
+TEST(SystemManager, FixedStepDeterminism)
+{
+    using namespace std::chrono;
+
+    // Two seconds of wall-clock time, split in three different ways
+    std::vector<nanoseconds> regular(125, milliseconds(16));
+    std::vector<nanoseconds> jittered;
+    std::vector<nanoseconds> stuttering;
+    std::mt19937 rng{7};
+    std::uniform_int_distribution<std::int64_t> jitter{1000, 30000000};
+
+    nanoseconds total{0};
+    while (total < seconds(2)) {
+        auto delta = std::min(nanoseconds(jitter(rng)), seconds(2) - total);
+        jittered.push_back(delta);
+        total += delta;
+    }
+    for (int i = 0; i < 4; ++i) {
+        stuttering.push_back(milliseconds(3));
+        stuttering.push_back(milliseconds(497));
+    }
+
+    std::uint64_t ticks[3];
+    auto a = Simulate(regular, ticks[0]);
+    auto b = Simulate(jittered, ticks[1]);
+    auto c = Simulate(stuttering, ticks[2]);
+
+    EXPECT_EQ(ticks[0], 200);
+    EXPECT_EQ(ticks[1], 200);
+    EXPECT_EQ(ticks[2], 200);
+    // Same steps in the same order: bitwise identical results
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a, c);
+}
+
+TEST(SystemManager, CatchUpCapAndAlpha)
+{
+    using namespace std::chrono;
+
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    sm.SetTimestep(Timestep{milliseconds(10), 4});
+    sm.Add<PhysicsSystem>();
+    auto render = sm.Add<InterpolationSystem>();
+
+    // A long hitch runs at most 4 steps, the remaining lag is dropped
+    EXPECT_EQ(sm.Update(milliseconds(1000)), 4);
+    EXPECT_LT(sm.Time().Alpha, 1.0);
+
+    EXPECT_EQ(sm.Update(milliseconds(5)), 0);
+    EXPECT_EQ(sm.Update(milliseconds(2)), 0);
+    EXPECT_EQ(sm.Update(milliseconds(4)), 1);
+    EXPECT_EQ(sm.Time().Tick, 5);
+
+    ASSERT_EQ(render->alphas.size(), 4);
+    EXPECT_DOUBLE_EQ(render->alphas[1] + 0.2, render->alphas[2]);
+    for (auto alpha : render->alphas) {
+        EXPECT_GE(alpha, 0.0);
+        EXPECT_LT(alpha, 1.0);
+    }
+}
+
+namespace
+{
+    class QuitSystem : public System<InPhase<Phase::Input>>
+    {
+    public:
+        explicit QuitSystem(bool &running) : _running(running) {}
+
+        void Update() override
+        {
+            if (++frames == 10) {
+                _running = false;
+            }
+        }
+
+        int frames{0};
+
+    private:
+        bool &_running;
+    };
+}
+
+TEST(SystemManager, TargetFrameRate)
+{
+    using namespace std::chrono;
+
+    EntityManager<> em;
+    SystemManager<> sm{em};
+    bool running{true};
+
+    sm.SetTimestep(Timestep{milliseconds(10), 5, milliseconds(5)});
+    auto quit = sm.Add<QuitSystem>(running);
+
+    auto start = steady_clock::now();
+    sm.Run(running);
+    auto elapsed = steady_clock::now() - start;
+
+    EXPECT_EQ(quit->frames, 10);
+    EXPECT_GE(elapsed, milliseconds(50));
+}
+
+namespace
+{
+    class QuerySystem : public System<Writes<Position>, Reads<Velocity>, Query<Position, Velocity>>
+    {
+    public:
+        void Update() override
+        {
+            ++updates;
+            for (auto et : _query->Entities) {
+                _em->Get<Position>(et)->x += _em->Get<Velocity>(et)->x;
+            }
+        }
+
+        int updates{0};
+    };
+
+    class ChangeSystem : public System<Reads<Health>, Query<Health>, SkipUnchanged>
+    {
+    public:
+        void Update() override
+        {
+            ++updates;
+            seen = _query->Entities.Size();
+        }
+
+        int updates{0};
+        std::size_t seen{0};
+    };
+}
+
+TEST(SystemManager, CachedQueries)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    auto moving = sm.Add<QuerySystem>();
+    auto changes = sm.Add<ChangeSystem>();
+
+    // Empty queries skip their systems
+    sm.Update();
+    EXPECT_EQ(moving->updates, 0);
+    EXPECT_EQ(changes->updates, 0);
+
+    auto et = em.Create();
+    em.Assign<Position>(et, Position{0});
+    em.Assign<Health>(et, Health{10});
+    sm.Update();
+    EXPECT_EQ(moving->updates, 0);
+    EXPECT_EQ(changes->updates, 1);
+
+    em.Assign<Velocity>(et, Velocity{2});
+    sm.Update();
+    sm.Update();
+    EXPECT_EQ(moving->updates, 2);
+    EXPECT_FLOAT_EQ(em.Get<Position>(et)->x, 4);
+    // Unchanged query
+    EXPECT_EQ(changes->updates, 1);
+
+    em.Get<Health>(et)->value = 0;
+    sm.Update();
+    EXPECT_EQ(changes->updates, 1);
+
+    em.Assign<Health>(em.Create(), Health{5});
+    sm.Update();
+    EXPECT_EQ(changes->updates, 2);
+    EXPECT_EQ(changes->seen, 2);
+
+    EXPECT_EQ(moving->updates, 4);
+    em.Delete<Velocity>(et);
+    sm.Update();
+    EXPECT_EQ(moving->updates, 4);
+}
+
+namespace
+{
+    std::vector<int> registry_log;
+    int destroyed{0};
+
+    // Undeclared, so every system has its own stage, in registration order
+    template <int N>
+    class LogSystem : public System<>
+    {
+    public:
+        ~LogSystem() override
+        {
+            ++destroyed;
+        }
+
+        void Update() override
+        {
+            registry_log.push_back(N);
+        }
+    };
+
+    class EditSystem : public System<>
+    {
+    public:
+        explicit EditSystem(SystemManager<> &sm) :
+            _sm(sm)
+        {}
+
+        ~EditSystem() override
+        {
+            ++destroyed;
+        }
+
+        void Update() override
+        {
+            registry_log.push_back(0);
+            _sm.Deactivate<LogSystem<1>>();
+            _sm.Remove<LogSystem<2>>();
+            _sm.Add<LogSystem<3>>();
+            // Destroyed at the end of the frame
+            _sm.Remove<EditSystem>();
+            registry_log.push_back(_sm.Has<EditSystem>() ? -1 : 0);
+        }
+
+    private:
+        SystemManager<> &_sm;
+    };
+
+    template <int N>
+    class SleepSystem : public System<Reads<Health>>
+    {
+    public:
+        void Update() override
+        {
+            Deactivate();
+        }
+    };
+
+    class GrowSystem : public System<Deferrable<>>
+    {
+    public:
+        explicit GrowSystem(SystemManager<> &sm) :
+            _sm(sm)
+        {}
+
+        void Update() override
+        {
+            Resume(std::chrono::nanoseconds::max());
+        }
+
+        bool Resume(std::chrono::nanoseconds) override
+        {
+            registry_log.push_back(0);
+            _sm.Add<LogSystem<5>>();
+            _sm.Add<LogSystem<6>>();
+            _sm.Add<LogSystem<7>>();
+            // Unfinished, so it runs again
+            return false;
+        }
+
+    private:
+        SystemManager<> &_sm;
+    };
+
+    class ScheduleQuerySystem : public System<>
+    {
+    public:
+        explicit ScheduleQuerySystem(SystemManager<> &sm) :
+            _sm(sm)
+        {}
+
+        void Update() override
+        {
+            _sm.Add<LogSystem<8>>();
+            // The schedule being run is kept until the next phase
+            stages = _sm.Stages();
+            stage = _sm.StageOf<LogSystem<9>>();
+            ticks = _sm.TicksOf<LogSystem<9>>();
+        }
+
+        std::size_t stages{0};
+        std::size_t stage{1};
+        std::pair<std::size_t, std::size_t> ticks;
+
+    private:
+        SystemManager<> &_sm;
+    };
+}
+
+TEST(SystemManager, Registry)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+    const auto &csm = sm;
+
+    registry_log.clear();
+    destroyed = 0;
+
+    EXPECT_FALSE(csm.Has<LogSystem<4>>());
+    EXPECT_EQ(csm.Get<LogSystem<4>>(), nullptr);
+
+    auto system = sm.Add<LogSystem<4>>();
+    EXPECT_TRUE(csm.Has<LogSystem<4>>());
+    EXPECT_EQ(csm.Get<LogSystem<4>>(), system);
+    // Already registered
+    EXPECT_EQ(sm.Add<LogSystem<4>>(), system);
+    EXPECT_EQ(destroyed, 0);
+
+    EXPECT_TRUE(system->IsActive());
+    sm.Deactivate<LogSystem<4>>();
+    EXPECT_FALSE(system->IsActive());
+    sm.Update();
+    system->Activate();
+    EXPECT_TRUE(system->IsActive());
+    sm.Update();
+    EXPECT_EQ(registry_log, std::vector<int>({4}));
+
+    sm.Remove<LogSystem<4>>();
+    EXPECT_EQ(destroyed, 1);
+    EXPECT_FALSE(csm.Has<LogSystem<4>>());
+    sm.Remove<LogSystem<4>>();
+    sm.Update();
+    EXPECT_EQ(registry_log, std::vector<int>({4}));
+}
+
+TEST(SystemManager, ChangesDuringUpdate)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    registry_log.clear();
+    destroyed = 0;
+
+    sm.Add<EditSystem>(sm);
+    sm.Add<LogSystem<1>>();
+    sm.Add<LogSystem<2>>();
+
+    // Later stages see the changes, the new system waits for the next frame
+    sm.Update();
+    EXPECT_EQ(registry_log, std::vector<int>({0, 0}));
+    EXPECT_EQ(destroyed, 2);
+    EXPECT_FALSE(sm.Has<EditSystem>());
+    EXPECT_FALSE(sm.Has<LogSystem<2>>());
+    EXPECT_TRUE(sm.Has<LogSystem<3>>());
+
+    sm.Update();
+    sm.Activate<LogSystem<1>>();
+    sm.Update();
+    EXPECT_EQ(registry_log, std::vector<int>({0, 0, 3, 1, 3}));
+}
+
+TEST(SystemManager, DeferrableChangesDuringUpdate)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    registry_log.clear();
+
+    // Adding systems from a resumable update may reallocate the registry
+    sm.Add<GrowSystem>(sm);
+    sm.Update();
+    EXPECT_EQ(registry_log, std::vector<int>({0}));
+    EXPECT_EQ(sm.Deferrals().Sliced, 1u);
+    EXPECT_EQ(sm.Deferrals().Pending, 1u);
+
+    sm.Update();
+    EXPECT_EQ(registry_log, std::vector<int>({0, 5, 6, 7, 0}));
+    EXPECT_EQ(sm.Deferrals().Sliced, 2u);
+}
+
+TEST(SystemManager, ScheduleQueriesDuringUpdate)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    registry_log.clear();
+
+    auto probe = sm.Add<ScheduleQuerySystem>(sm);
+    sm.Add<LogSystem<1>>();
+    sm.Update();
+    EXPECT_EQ(probe->stages, 2u);
+    EXPECT_EQ(probe->stage, 0u);
+    EXPECT_EQ(probe->ticks, (std::pair<std::size_t, std::size_t>(1, 0)));
+    EXPECT_EQ(registry_log, std::vector<int>({1}));
+
+    EXPECT_EQ(sm.Stages(), 3u);
+    EXPECT_EQ(sm.StageOf<LogSystem<8>>(), 2u);
+    sm.Update();
+    EXPECT_EQ(registry_log, std::vector<int>({1, 1, 8}));
+}
+
+TEST(SystemManager, ConcurrentDeactivation)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em, 3};
+
+    em.Assign<Health>(em.Create(), Health{1});
+    for (int i = 0; i < 100; ++i) {
+        sm.Add<SleepSystem<0>>();
+        sm.Add<SleepSystem<1>>();
+        sm.Add<SleepSystem<2>>();
+        sm.Add<SleepSystem<3>>();
+        ASSERT_EQ(sm.Stages(), 1u);
+
+        sm.Update();
+        EXPECT_FALSE(sm.Get<SleepSystem<0>>()->IsActive());
+        EXPECT_FALSE(sm.Get<SleepSystem<1>>()->IsActive());
+        EXPECT_FALSE(sm.Get<SleepSystem<2>>()->IsActive());
+        EXPECT_FALSE(sm.Get<SleepSystem<3>>()->IsActive());
+
+        sm.Remove<SleepSystem<0>>();
+        sm.Remove<SleepSystem<1>>();
+        sm.Remove<SleepSystem<2>>();
+        sm.Remove<SleepSystem<3>>();
+    }
+}
+
+namespace
+{
+    std::vector<int> budget_log;
+    bool spike{false};
+    // Frames are timed by this clock, only advanced by the spikes
+    std::chrono::steady_clock::time_point budget_now;
+
+    class SpikeSystem : public System<Writes<Health>>
+    {
+    public:
+        void Update() override
+        {
+            if (spike) {
+                budget_now += std::chrono::milliseconds{6};
+            }
+        }
+    };
+
+    // Plans one path per millisecond of budget, 10 paths per round
+    class PlanSystem : public System<Reads<Health>, Deferrable<5>>
+    {
+    public:
+        static constexpr std::size_t Paths = 10;
+
+        void Update() override
+        {
+            Resume(std::chrono::nanoseconds::max());
+        }
+
+        bool Resume(std::chrono::nanoseconds budget) override
+        {
+            auto count = std::max<std::size_t>(static_cast<std::size_t>(budget / std::chrono::milliseconds{1}), 1);
+
+            budget_log.push_back(1);
+            planned += std::min(count, Paths - planned);
+            if (planned < Paths) {
+                return false;
+            }
+            planned = 0;
+            ++rounds;
+            return true;
+        }
+
+        std::size_t planned{0};
+        int rounds{0};
+    };
+
+    class StatsSystem : public System<Reads<Health>, Deferrable<>>
+    {
+    public:
+        void Update() override
+        {
+            budget_log.push_back(0);
+        }
+    };
+}
+
+TEST(SystemManager, FrameBudget)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    budget_log.clear();
+    spike = false;
+
+    sm.Add<StatsSystem>();
+    auto plan = sm.Add<PlanSystem>();
+    sm.Add<SpikeSystem>();
+
+    // Without budget, every system runs by priority
+    sm.Update();
+    EXPECT_EQ(budget_log, std::vector<int>({1, 0}));
+    EXPECT_EQ(plan->rounds, 1);
+
+    Timestep timestep;
+    timestep.Budget = std::chrono::microseconds{3900};
+    timestep.MaxDeferrals = 2;
+    timestep.Now = []() noexcept {
+        return budget_now;
+    };
+    sm.SetTimestep(timestep);
+
+    // Time-sliced
+    sm.Update();
+    EXPECT_EQ(plan->planned, 3u);
+    EXPECT_EQ(sm.Deferrals().Sliced, 1u);
+    EXPECT_EQ(sm.Deferrals().Pending, 1u);
+
+    // Postponed while the budget is spent
+    spike = true;
+    sm.Update();
+    sm.Update();
+    EXPECT_EQ(plan->planned, 3u);
+    EXPECT_EQ(sm.Deferrals().Deferred, 4u);
+    EXPECT_EQ(sm.Deferrals().Pending, 2u);
+
+    // Run over budget after 2 postponed frames, one path at least
+    sm.Update();
+    EXPECT_EQ(plan->planned, 4u);
+    EXPECT_EQ(sm.Deferrals().Forced, 2u);
+    EXPECT_EQ(sm.Deferrals().OverBudget, 3u);
+    EXPECT_EQ(sm.Deferrals().Pending, 1u);
+
+    spike = false;
+    sm.Update();
+    sm.Update();
+    EXPECT_EQ(plan->rounds, 2);
+    EXPECT_EQ(plan->planned, 0u);
+    EXPECT_EQ(sm.Deferrals().Pending, 0u);
+    EXPECT_EQ(budget_log, std::vector<int>({1, 0, 1, 0, 1, 0, 1, 0, 1, 0}));
+}
+
+namespace
+{
+    int rate_counts[5]{};
+
+    template <int N, unsigned Hz>
+    class RateSystem : public System<Reads<Health>, InPhase<Phase::FixedUpdate>, Rate<Hz>>
+    {
+    public:
+        void Update() override
+        {
+            ++rate_counts[N];
+        }
+    };
+
+    class SliceSystem : public System<Writes<Health>, Query<Health>, Sliced<4>>
+    {
+    public:
+        void Update() override
+        {
+            auto [begin, end] = SliceRange(_query->Entities.Size());
+
+            for (auto i = begin; i < end; ++i) {
+                _em->Get<Health>(*(_query->Entities.Begin() + i))->value += 1;
+            }
+        }
+    };
+}
+
+TEST(SystemManager, Rates)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    sm.Add<RateSystem<0, 60>>();
+    sm.Add<RateSystem<1, 20>>();
+    sm.Add<RateSystem<2, 20>>();
+    sm.Add<RateSystem<3, 10>>();
+    sm.Add<RateSystem<4, 1>>();
+
+    // Staggered over the frames of a 60 Hz timestep
+    using Ticks = std::pair<std::size_t, std::size_t>;
+    EXPECT_EQ((sm.TicksOf<RateSystem<0, 60>>()), Ticks(1, 0));
+    EXPECT_EQ((sm.TicksOf<RateSystem<1, 20>>()), Ticks(3, 0));
+    EXPECT_EQ((sm.TicksOf<RateSystem<2, 20>>()), Ticks(3, 1));
+    EXPECT_EQ((sm.TicksOf<RateSystem<3, 10>>()), Ticks(6, 2));
+    EXPECT_EQ((sm.TicksOf<RateSystem<4, 1>>()), Ticks(60, 5));
+
+    for (int i = 0; i < 60; ++i) {
+        auto before = rate_counts[1] + rate_counts[2] + rate_counts[3] + rate_counts[4];
+        sm.Update();
+        // Low-rate systems never share a frame
+        EXPECT_LE(rate_counts[1] + rate_counts[2] + rate_counts[3] + rate_counts[4] - before, 1);
+    }
+    EXPECT_EQ(rate_counts[0], 60);
+    EXPECT_EQ(rate_counts[1], 20);
+    EXPECT_EQ(rate_counts[2], 20);
+    EXPECT_EQ(rate_counts[3], 10);
+    EXPECT_EQ(rate_counts[4], 1);
+
+    Timestep timestep;
+    timestep.Fixed = std::chrono::nanoseconds{1000000000} / 30;
+    sm.SetTimestep(timestep);
+    EXPECT_EQ((sm.TicksOf<RateSystem<3, 10>>().first), 3u);
+}
+
+TEST(SystemManager, Slices)
+{
+    EntityManager<> em;
+    SystemManager<> sm{em};
+
+    for (int i = 0; i < 10; ++i) {
+        em.Assign<Health>(em.Create(), Health{0});
+    }
+    sm.Add<SliceSystem>();
+
+    // Every entity is updated once every 4 frames
+    for (int round = 1; round <= 2; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            sm.Update();
+        }
+        em.ForEach<Health>([&](auto, Health &health) {
+            EXPECT_EQ(health.value, round);
+        });
+    }
+}
\ No newline at end of file
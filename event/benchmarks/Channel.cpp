@@ -0,0 +1,147 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/event/Channel.hpp>
+
+static constexpr std::size_t EventsCount = 400000;
+static constexpr std::size_t Capacity = 4096;
+
+struct WalkEventArgs
+{
+    int X;
+    int Y;
+    indie::bench::Clock::time_point Sent;
+};
+
+/**
+ * @brief Game side observer, records the time each subject spent in transit.
+ *
+ */
+struct Simulation
+{
+    void OnReceive(indie::event::Span<WalkEventArgs> events)
+    {
+        auto now = indie::bench::Clock::now();
+
+        for (auto &args : events) {
+            Latencies.push_back(std::chrono::duration<double, std::nano>(now - args.Sent).count());
+        }
+    }
+
+    std::vector<double> Latencies;
+};
+
+/**
+ * @brief Baseline, a vector swapped under a mutex.
+ *
+ */
+struct LockedQueue
+{
+    void Send(const WalkEventArgs &args)
+    {
+        std::lock_guard<std::mutex> lock{Mutex};
+        Pending.push_back(args);
+    }
+
+    std::size_t Drain(indie::event::EventManager &em)
+    {
+        {
+            std::lock_guard<std::mutex> lock{Mutex};
+            std::swap(Pending, Draining);
+        }
+        for (auto &args : Draining) {
+            em.Enqueue<WalkEventArgs>(args);
+        }
+
+        auto count = Draining.size();
+        Draining.clear();
+        return count;
+    }
+
+    std::mutex Mutex;
+    std::vector<WalkEventArgs> Pending;
+    std::vector<WalkEventArgs> Draining;
+};
+
+/**
+ * @brief Producers send their share of subjects while the calling thread drains and dispatches them.
+ *
+ */
+template <typename Send, typename Drain>
+static void Run(const char *name, std::size_t producers, Send &&send, Drain &&drain)
+{
+    indie::event::EventManager em;
+    Simulation simulation;
+    std::vector<std::thread> threads;
+    std::atomic<bool> start{false};
+
+    em.Register<WalkEventArgs>(simulation);
+    simulation.Latencies.reserve(EventsCount);
+
+    auto result = indie::bench::Measure(name, EventsCount, [&]() {
+        for (std::size_t producer = 0; producer < producers; ++producer) {
+            threads.emplace_back([&, producer] {
+                while (!start.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                for (std::size_t i = producer; i < EventsCount; i += producers) {
+                    send(WalkEventArgs{static_cast<int>(i), 0, indie::bench::Clock::now()});
+                }
+            });
+        }
+        start.store(true, std::memory_order_release);
+
+        std::size_t received = 0;
+        while (received < EventsCount) {
+            auto drained = drain(em);
+            em.Dispatch();
+            received += drained;
+            if (!drained) {
+                std::this_thread::yield();
+            }
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    });
+
+    auto &latencies = simulation.Latencies;
+    std::sort(latencies.begin(), latencies.end());
+    indie::bench::Report(result);
+    std::cout << "    latency: p50 " << latencies[latencies.size() / 2] / 1e3
+              << " us, p99 " << latencies[latencies.size() * 99 / 100] / 1e3
+              << " us, p99.9 " << latencies[latencies.size() * 999 / 1000] / 1e3 << " us" << std::endl;
+}
+
+int main()
+{
+    static const char *ChannelNames[] = {"Channel, 1 producer, events", "Channel, 2 producers, events",
+                                         "Channel, 4 producers, events", "Channel, 8 producers, events",
+                                         "Channel, 16 producers, events"};
+    static const char *LockedNames[] = {"std::mutex, 1 producer, events", "std::mutex, 2 producers, events",
+                                        "std::mutex, 4 producers, events", "std::mutex, 8 producers, events",
+                                        "std::mutex, 16 producers, events"};
+
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    for (std::size_t i = 0, producers = 1; producers <= 16; ++i, producers *= 2) {
+        indie::event::Channel<WalkEventArgs> channel{Capacity, indie::event::Overflow::Wait};
+        Run(ChannelNames[i], producers, [&](const WalkEventArgs &args) {
+            channel.Send<WalkEventArgs>(args);
+        }, [&](indie::event::EventManager &em) {
+            return channel.Drain(em);
+        });
+
+        LockedQueue locked;
+        Run(LockedNames[i], producers, [&](const WalkEventArgs &args) {
+            locked.Send(args);
+        }, [&](indie::event::EventManager &em) {
+            return locked.Drain(em);
+        });
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/event/EventManager.hpp>
+
+static constexpr int ClientsCount = 1000;
+/*! Inputs sent by each client between two simulation frames */
+static constexpr int InputsPerFrame = 20;
+static constexpr int FramesCount = 200;
+/*! Walls checked by each move */
+static constexpr int WallsCount = 64;
+
+template <int N>
+struct WalkEventArgs
+{
+    int Player;
+    float X;
+    float Y;
+};
+
+using RawWalk = WalkEventArgs<0>;
+using CoalescedWalk = WalkEventArgs<1>;
+
+template <>
+struct indie::event::Coalescing<CoalescedWalk> : indie::event::CoalesceBy<&CoalescedWalk::Player>
+{};
+
+/**
+ * @brief Moves players, checking each move against the walls of the map.
+ *
+ */
+struct Simulation
+{
+    template <typename Walk>
+    void OnReceive(indie::event::Span<Walk> events)
+    {
+        for (auto &args : events) {
+            bool blocked = false;
+
+            for (int wall = 0; wall < WallsCount; ++wall) {
+                auto dx = args.X - static_cast<float>(wall * 16);
+                auto dy = args.Y - static_cast<float>(wall * 8);
+
+                blocked |= std::sqrt(dx * dx + dy * dy) < 0.5f;
+            }
+            if (!blocked) {
+                Positions[args.Player] = {args.X, args.Y};
+            }
+            ++Processed;
+        }
+    }
+
+    std::vector<std::pair<float, float>> Positions = std::vector<std::pair<float, float>>(ClientsCount);
+    std::size_t Processed{0};
+};
+
+template <typename Walk>
+static void Run(const char *name)
+{
+    indie::event::EventManager em;
+    Simulation simulation;
+
+    std::chrono::nanoseconds dispatching{0};
+
+    em.Register<Walk>(simulation);
+    indie::bench::Run(name, ClientsCount * InputsPerFrame * FramesCount, [&]() {
+        for (int frame = 0; frame < FramesCount; ++frame) {
+            for (int input = 0; input < InputsPerFrame; ++input) {
+                for (int client = 0; client < ClientsCount; ++client) {
+                    em.template Enqueue<Walk>(client, static_cast<float>(frame + input), static_cast<float>(client));
+                }
+            }
+
+            auto start = indie::bench::Clock::now();
+            em.Dispatch();
+            dispatching += indie::bench::Clock::now() - start;
+        }
+    });
+    std::cout << "    per frame: " << simulation.Processed / FramesCount << " subjects processed, dispatch "
+              << std::chrono::duration<double, std::micro>(dispatching).count() / FramesCount << " us" << std::endl;
+    indie::bench::DoNotOptimize(simulation.Positions.front());
+}
+
+int main()
+{
+    Run<RawWalk>("Walk inputs, queued, inputs");
+    Run<CoalescedWalk>("Walk inputs, coalesced by player, inputs");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <iostream>
+#include <vector>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/event/EventManager.hpp>
+
+static constexpr int ObserversCount = 5000;
+
+template <int N>
+struct TickEventArgs
+{
+    int Value;
+};
+
+/**
+ * @brief Observes 16 subjects, like a player listening to inputs, hits, chat...
+ *
+ */
+struct Listener
+{
+    template <int N>
+    void OnReceive(TickEventArgs<N> &args)
+    {
+        Total += args.Value;
+    }
+
+    int Total{0};
+};
+
+template <typename Func>
+static void Run(const char *name, Func &&unregister)
+{
+    indie::event::EventManager em;
+    std::vector<Listener> listeners(ObserversCount);
+    std::vector<indie::event::Connection> connections;
+
+    for (auto &listener : listeners) {
+        connections.push_back(em.Register<TickEventArgs<0>, TickEventArgs<1>, TickEventArgs<2>, TickEventArgs<3>,
+                                          TickEventArgs<4>, TickEventArgs<5>, TickEventArgs<6>, TickEventArgs<7>,
+                                          TickEventArgs<8>, TickEventArgs<9>, TickEventArgs<10>, TickEventArgs<11>,
+                                          TickEventArgs<12>, TickEventArgs<13>, TickEventArgs<14>, TickEventArgs<15>>(listener));
+    }
+    // Players leave in join order, the worst case of a search from the front would be the reverse
+    indie::bench::Run(name, ObserversCount, [&]() {
+        for (std::size_t i = 0; i < listeners.size(); ++i) {
+            unregister(em, listeners[i], connections[i]);
+        }
+    });
+    indie::bench::DoNotOptimize(em.Has(listeners.back()));
+}
+
+int main()
+{
+    Run("Unregister 5000 observers of 16 subjects, by pointer, observers",
+        [](indie::event::EventManager &em, Listener &listener, indie::event::Connection) {
+            em.Unregister(listener);
+        });
+    Run("Unregister 5000 observers of 16 subjects, by connection, observers",
+        [](indie::event::EventManager &em, Listener &, indie::event::Connection connection) {
+            em.Disconnect(connection);
+        });
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <vector>
+#include <functional>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/event/EventManager.hpp>
+
+static constexpr std::size_t ObserversCount = 1000;
+static constexpr std::size_t NotificationsCount = 20000;
+
+struct DamageEventArgs
+{
+    int Value{1};
+};
+
+struct Player
+{
+    void OnReceive(DamageEventArgs &args)
+    {
+        Hp -= args.Value;
+    }
+
+    int Hp{0};
+};
+
+struct Squad
+{
+    void OnReceive(indie::event::Span<DamageEventArgs> events)
+    {
+        for (auto &args : events) {
+            Hp -= args.Value;
+        }
+    }
+
+    int Hp{0};
+};
+
+int main()
+{
+    std::vector<Player> players(ObserversCount);
+    DamageEventArgs args;
+
+    // Baseline, what `Observer` used to wrap
+    std::vector<std::function<void(DamageEventArgs &)>> callbacks;
+    for (auto &player : players) {
+        callbacks.emplace_back([&player](DamageEventArgs &args) {
+            player.OnReceive(args);
+        });
+    }
+    indie::bench::Run("std::function, calls", ObserversCount * NotificationsCount, [&]() {
+        for (std::size_t i = 0; i < NotificationsCount; ++i) {
+            for (auto &callback : callbacks) {
+                callback(args);
+            }
+        }
+    });
+
+    indie::event::EventManager em;
+    for (auto &player : players) {
+        em.Register<DamageEventArgs>(player);
+    }
+    indie::bench::Run("EventManager::Notify, calls", ObserversCount * NotificationsCount, [&]() {
+        for (std::size_t i = 0; i < NotificationsCount; ++i) {
+            em.Notify<DamageEventArgs>(args);
+        }
+    });
+
+    // Dispatch cost with few observers
+    indie::event::EventManager single;
+    single.Register<DamageEventArgs>(players.front());
+    indie::bench::Run("EventManager::Notify, 1 observer, notifications", NotificationsCount * 100, [&]() {
+        for (std::size_t i = 0; i < NotificationsCount * 100; ++i) {
+            single.Notify<DamageEventArgs>(args);
+        }
+    });
+
+    // Queued, subjects delivered by batches of a frame
+    static constexpr std::size_t FrameEvents = 1000;
+    indie::event::EventManager queued;
+    std::vector<Squad> squads(ObserversCount / 100);
+    for (auto &squad : squads) {
+        queued.Register<DamageEventArgs>(squad);
+    }
+    indie::bench::Run("EventManager::Enqueue + Dispatch, span observers, events", NotificationsCount * FrameEvents, [&]() {
+        for (std::size_t i = 0; i < NotificationsCount; ++i) {
+            for (std::size_t j = 0; j < FrameEvents; ++j) {
+                queued.Enqueue<DamageEventArgs>(args);
+            }
+            queued.Dispatch();
+        }
+    });
+    indie::bench::Run("EventManager::Notify, same observers, events", NotificationsCount * FrameEvents, [&]() {
+        for (std::size_t i = 0; i < NotificationsCount * FrameEvents; ++i) {
+            queued.Notify<DamageEventArgs>(args);
+        }
+    });
+
+    indie::bench::DoNotOptimize(players.front().Hp);
+    indie::bench::DoNotOptimize(squads.front().Hp);
+    return 0;
+}
\ No newline at end of file
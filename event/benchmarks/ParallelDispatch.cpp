@@ -0,0 +1,115 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <thread>
+#include <cstdint>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/event/ParallelDispatcher.hpp>
+
+static constexpr int FramesCount = 100;
+static constexpr int CuesPerFrame = 500;
+static constexpr int PlayersCount = 64;
+static constexpr int AnalyticsPerFrame = 2000;
+/*! Samples synthesized by each audio cue */
+static constexpr int SamplesCount = 64;
+/*! Hashing rounds of each analytics subject */
+static constexpr int RoundsCount = 256;
+
+struct AudioCueEventArgs
+{
+    int Sound;
+    float Volume;
+};
+
+struct AnalyticsEventArgs
+{
+    int Player;
+    int Value;
+};
+
+template <>
+struct indie::event::Lanes<AnalyticsEventArgs> : indie::event::LaneBy<&AnalyticsEventArgs::Player>
+{};
+
+/**
+ * @brief Synthesizes the samples of each cue.
+ *
+ */
+struct Mixer
+{
+    void OnReceive(AudioCueEventArgs &args)
+    {
+        for (int i = 0; i < SamplesCount; ++i) {
+            Output += args.Volume * std::sin(static_cast<float>(args.Sound * SamplesCount + i) * 0.01f);
+        }
+    }
+
+    float Output{0};
+};
+
+/**
+ * @brief Aggregates a digest per player, each player is only touched by the lane of its key.
+ *
+ */
+struct Stats
+{
+    void OnReceive(AnalyticsEventArgs &args)
+    {
+        auto digest = Digests[static_cast<std::size_t>(args.Player)];
+
+        for (int i = 0; i < RoundsCount; ++i) {
+            digest = (digest ^ static_cast<std::uint64_t>(args.Value + i)) * 0x100000001B3ull;
+        }
+        Digests[static_cast<std::size_t>(args.Player)] = digest;
+    }
+
+    std::vector<std::uint64_t> Digests = std::vector<std::uint64_t>(PlayersCount, 0xCBF29CE484222325ull);
+};
+
+/**
+ * @brief Queues and dispatches the subjects of every frame.
+ *
+ * @param name Name displayed in the report.
+ * @param workers Number of workers of the parallel dispatcher, serial dispatch if negative.
+ */
+static void Run(const char *name, int workers)
+{
+    indie::event::EventManager em;
+    indie::event::ParallelDispatcher parallel{em, workers < 0 ? 0 : static_cast<std::size_t>(workers)};
+    Mixer mixer;
+    Stats stats;
+
+    em.Register<AudioCueEventArgs>(mixer);
+    em.Register<AnalyticsEventArgs>(stats);
+    indie::bench::Run(name, (CuesPerFrame + AnalyticsPerFrame) * FramesCount, [&]() {
+        for (int frame = 0; frame < FramesCount; ++frame) {
+            for (int i = 0; i < CuesPerFrame; ++i) {
+                em.Enqueue<AudioCueEventArgs>(i, 0.5f);
+            }
+            for (int i = 0; i < AnalyticsPerFrame; ++i) {
+                em.Enqueue<AnalyticsEventArgs>(i % PlayersCount, frame + i);
+            }
+            if (workers < 0) {
+                em.Dispatch<AudioCueEventArgs, AnalyticsEventArgs>();
+            }
+            else {
+                parallel.Dispatch<AudioCueEventArgs, AnalyticsEventArgs>();
+                parallel.Flush();
+            }
+        }
+    });
+    indie::bench::DoNotOptimize(mixer.Output);
+    indie::bench::DoNotOptimize(stats.Digests.front());
+}
+
+int main()
+{
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    Run("Heavy observers, serial, subjects", -1);
+    Run("Heavy observers, 1 worker, subjects", 1);
+    Run("Heavy observers, 2 workers, subjects", 2);
+    Run("Heavy observers, 4 workers, subjects", 4);
+    Run("Heavy observers, 8 workers, subjects", 8);
+    return 0;
+}
\ No newline at end of file
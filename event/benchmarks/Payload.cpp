@@ -0,0 +1,125 @@
+#include <iostream>
+#include <memory>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/event/EventManager.hpp>
+#include <indie/event/Payload.hpp>
+
+static constexpr int FramesCount = 200;
+static constexpr int ChunksPerFrame = 256;
+static constexpr int ObserversCount = 8;
+
+/**
+ * @brief Map chunk update, 4 KiB of tiles.
+ *
+ */
+struct ChunkData
+{
+    int Tiles[1024];
+};
+
+struct ValueChunkEventArgs
+{
+    int X;
+    ChunkData Data;
+};
+
+struct SharedChunkEventArgs
+{
+    int X;
+    std::shared_ptr<ChunkData> Data;
+};
+
+struct PooledChunkEventArgs
+{
+    int X;
+    indie::event::Pooled<ChunkData> Data;
+};
+
+static const ChunkData &Payload(const ValueChunkEventArgs &args)
+{
+    return args.Data;
+}
+
+template <typename Subject>
+static const ChunkData &Payload(const Subject &args)
+{
+    return *args.Data;
+}
+
+/**
+ * @brief Samples a few tiles of each chunk, the minimap also keeps the last chunk.
+ *
+ */
+template <typename Subject>
+struct ChunkRenderer
+{
+    void OnReceive(Subject &args)
+    {
+        for (int i = 0; i < 1024; i += 64) {
+            Total += Payload(args).Tiles[i];
+        }
+        if (Keep) {
+            Last = args;
+        }
+    }
+
+    bool Keep{false};
+    long Total{0};
+    Subject Last{};
+};
+
+static void Fill(ChunkData &data, int x) noexcept
+{
+    for (int i = 0; i < 1024; ++i) {
+        data.Tiles[i] = x + i;
+    }
+}
+
+template <typename Subject, typename Func>
+static void Run(const char *name, Func &&enqueue)
+{
+    indie::event::EventManager em;
+    std::unique_ptr<ChunkRenderer<Subject>[]> renderers{new ChunkRenderer<Subject>[ObserversCount]};
+
+    for (int i = 0; i < ObserversCount; ++i) {
+        em.Register<Subject>(renderers[i]);
+    }
+    renderers[0].Keep = true;
+    indie::bench::Run(name, FramesCount * ChunksPerFrame, [&]() {
+        for (int frame = 0; frame < FramesCount; ++frame) {
+            for (int x = 0; x < ChunksPerFrame; ++x) {
+                enqueue(em, x);
+            }
+            em.Dispatch();
+        }
+    });
+    indie::bench::DoNotOptimize(renderers[ObserversCount - 1].Total);
+}
+
+int main()
+{
+    Run<ValueChunkEventArgs>("4 KiB chunks, 8 observers, by value, chunks", [](indie::event::EventManager &em, int x) {
+        ValueChunkEventArgs args;
+
+        args.X = x;
+        Fill(args.Data, x);
+        em.Enqueue<ValueChunkEventArgs>(args);
+    });
+    Run<SharedChunkEventArgs>("4 KiB chunks, 8 observers, shared_ptr, chunks", [](indie::event::EventManager &em, int x) {
+        auto data = std::make_shared<ChunkData>();
+
+        Fill(*data, x);
+        em.Enqueue<SharedChunkEventArgs>(x, std::move(data));
+    });
+
+    indie::event::PayloadPool<ChunkData> chunks;
+    Run<PooledChunkEventArgs>("4 KiB chunks, 8 observers, pooled, chunks", [&chunks](indie::event::EventManager &em, int x) {
+        auto data = chunks.Make();
+
+        Fill(*data, x);
+        em.Enqueue<PooledChunkEventArgs>(x, std::move(data));
+    });
+    std::cout << "    pool: " << chunks.Capacity() << " payloads allocated" << std::endl;
+    return 0;
+}
\ No newline at end of file
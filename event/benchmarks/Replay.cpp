@@ -0,0 +1,94 @@
+#include <iostream>
+#include <cstdio>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/event/Player.hpp>
+
+static constexpr std::size_t FramesCount = 10000;
+static constexpr std::size_t EventsPerFrame = 100;
+static const char *RecordingPath = "indie_event_replay_benchmark.ievr";
+
+struct WalkEventArgs
+{
+    int Player;
+    float X;
+    float Y;
+};
+
+struct Simulation
+{
+    void OnReceive(WalkEventArgs &args)
+    {
+        X += args.X;
+    }
+
+    float X{0};
+};
+
+/**
+ * @brief Plays a session, a batch of queued walks per frame.
+ *
+ */
+static void Session(indie::event::EventManager &em, indie::event::Recorder *recorder)
+{
+    for (std::size_t frame = 0; frame < FramesCount; ++frame) {
+        if (recorder) {
+            recorder->SetTick(frame);
+        }
+        for (std::size_t i = 0; i < EventsPerFrame; ++i) {
+            em.Enqueue<WalkEventArgs>(static_cast<int>(i), static_cast<float>(frame), 0.f);
+        }
+        em.Dispatch();
+    }
+}
+
+int main()
+{
+    Simulation simulation;
+
+    {
+        indie::event::EventManager em;
+
+        em.Register<WalkEventArgs>(simulation);
+        indie::bench::Run("Session, not recorded, events", FramesCount * EventsPerFrame, [&]() {
+            Session(em, nullptr);
+        });
+    }
+
+    {
+        indie::event::EventManager em;
+        indie::event::Recorder recorder{RecordingPath};
+
+        recorder.Record<WalkEventArgs>(1);
+        em.Register<WalkEventArgs>(simulation);
+        em.Record(&recorder);
+        indie::bench::Run("Session, recorded, events", FramesCount * EventsPerFrame, [&]() {
+            Session(em, &recorder);
+            recorder.Flush();
+        });
+    }
+
+    {
+        indie::event::EventManager em;
+        indie::event::Player player{RecordingPath};
+
+        player.Bind<WalkEventArgs>(1);
+        em.Register<WalkEventArgs>(simulation);
+        indie::bench::Run("Replay, tick by tick, events", FramesCount * EventsPerFrame, [&]() {
+            for (std::uint64_t tick = 0; !player.Done(); ++tick) {
+                player.Play(em, tick);
+                em.Dispatch();
+            }
+        });
+
+        player.Rewind();
+        indie::bench::Run("Replay, as fast as possible, events", FramesCount * EventsPerFrame, [&]() {
+            player.PlayAll(em);
+            em.Dispatch();
+        });
+    }
+
+    std::remove(RecordingPath);
+    indie::bench::DoNotOptimize(simulation.X);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <vector>
+
+#include <indie/bench/Benchmark.hpp>
+#include <indie/event/EventManager.hpp>
+#include <indie/event/StaticEventBus.hpp>
+
+static constexpr std::size_t NotificationsCount = 10000000;
+
+template <int N>
+struct EventArgs
+{
+    int Value{1};
+};
+
+using Subjects = indie::meta::TypeList<EventArgs<0>, EventArgs<1>, EventArgs<2>, EventArgs<3>,
+                                       EventArgs<4>, EventArgs<5>, EventArgs<6>, EventArgs<7>>;
+
+struct Score
+{
+    template <int N>
+    void OnReceive(EventArgs<N> &args)
+    {
+        Total += args.Value;
+    }
+
+    int Total{0};
+};
+
+/**
+ * @brief Same work as `Score`, as a compile-time handler.
+ *
+ */
+struct ScoreHandler
+{
+    template <int N>
+    void operator()(EventArgs<N> &args)
+    {
+        Total += args.Value;
+    }
+
+    int Total{0};
+};
+
+int main()
+{
+    // Kept opaque so the handler loop is not folded into a single addition
+    EventArgs<7> args;
+
+    {
+        indie::event::EventManager em;
+        Score score;
+
+        em.Register<EventArgs<0>, EventArgs<1>, EventArgs<2>, EventArgs<3>,
+                    EventArgs<4>, EventArgs<5>, EventArgs<6>, EventArgs<7>>(score);
+        indie::bench::Run("EventManager::Notify, notifications", NotificationsCount, [&]() {
+            for (std::size_t i = 0; i < NotificationsCount; ++i) {
+                em.Notify(args);
+                indie::bench::DoNotOptimize(args);
+            }
+        });
+        indie::bench::DoNotOptimize(score.Total);
+    }
+
+    {
+        indie::event::StaticEventBus<Subjects> bus;
+        Score score;
+
+        bus.Register<EventArgs<0>, EventArgs<1>, EventArgs<2>, EventArgs<3>,
+                     EventArgs<4>, EventArgs<5>, EventArgs<6>, EventArgs<7>>(score);
+        indie::bench::Run("StaticEventBus, observer, notifications", NotificationsCount, [&]() {
+            for (std::size_t i = 0; i < NotificationsCount; ++i) {
+                bus.Notify(args);
+                indie::bench::DoNotOptimize(args);
+            }
+        });
+        indie::bench::DoNotOptimize(score.Total);
+    }
+
+    {
+        indie::event::StaticEventBus<Subjects, ScoreHandler> bus;
+
+        indie::bench::Run("StaticEventBus, handler, notifications", NotificationsCount, [&]() {
+            for (std::size_t i = 0; i < NotificationsCount; ++i) {
+                bus.Notify(args);
+                indie::bench::DoNotOptimize(args);
+            }
+        });
+        indie::bench::DoNotOptimize(bus.Get<ScoreHandler>().Total);
+    }
+    return 0;
+}
\ No newline at end of file
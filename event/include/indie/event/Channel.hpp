@@ -0,0 +1,283 @@
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <indie/meta/Tuple.hpp>
+
+#include "EventManager.hpp"
+
+namespace indie::event
+{
+    /**
+     * @brief What a producer does when the queue of a subject is full.
+     *
+     */
+    enum class Overflow
+    {
+        /*! The subject is discarded and counted as dropped */
+        Drop,
+        /*! The producer yields until the consumer makes room */
+        Wait
+    };
+
+    namespace details
+    {
+        /*! Keeps producer and consumer counters on distinct cache lines */
+        static constexpr std::size_t CacheLineSize = 64;
+
+        /**
+         * @brief Bounded lock-free queue, many producers and a single consumer.
+         *
+         * Each cell carries a sequence number telling whether it is free for the producer
+         * of a lap or ready for the consumer. Producers claim a cell with a single CAS on the head,
+         * the consumer owns the tail and never writes a shared counter but the cell sequence.
+         *
+         * @tparam T Type of the elements.
+         */
+        template <typename T>
+        class MpscRing
+        {
+        public:
+            /**
+             * @brief Constructor.
+             *
+             * @param capacity Maximum number of elements, rounded up to a power of two.
+             */
+            explicit MpscRing(std::size_t capacity)
+            {
+                std::size_t size = 2;
+
+                while (size < capacity) {
+                    size <<= 1;
+                }
+                _mask = size - 1;
+                _cells = std::make_unique<Cell[]>(size);
+                for (std::size_t i = 0; i < size; ++i) {
+                    _cells[i].Sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            ~MpscRing()
+            {
+                Drain([](T &&) {}, Capacity());
+            }
+
+            MpscRing(const MpscRing &other) = delete;
+            MpscRing &operator=(const MpscRing &other) = delete;
+
+            /**
+             * @brief Pushes an element constructed from arguments, from any thread.
+             *
+             * @tparam Args Types of the arguments.
+             * @param args Arguments of the element constructor.
+             * @return False if the queue is full.
+             */
+            template <typename ...Args>
+            bool TryPush(Args &&...args)
+            {
+                auto head = _head.load(std::memory_order_relaxed);
+
+                for (;;) {
+                    auto &cell = _cells[head & _mask];
+                    auto sequence = cell.Sequence.load(std::memory_order_acquire);
+                    auto diff = static_cast<std::ptrdiff_t>(sequence - head);
+
+                    if (diff == 0) {
+                        if (_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                            new (&cell.Storage) T{std::forward<Args>(args)...};
+                            cell.Sequence.store(head + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0) {
+                        // The consumer has not freed this cell since the previous lap
+                        return false;
+                    }
+                    else {
+                        head = _head.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            /**
+             * @brief Pops ready elements, from the consumer thread only.
+             *
+             * @tparam Func Type of the function receiving the elements.
+             * @param func Function called with each element, as an rvalue.
+             * @param max Maximum number of elements to pop, bounds the call while producers keep pushing.
+             * @return The number of popped elements.
+             */
+            template <typename Func>
+            std::size_t Drain(Func &&func, std::size_t max)
+            {
+                std::size_t count = 0;
+
+                while (count < max) {
+                    auto &cell = _cells[_tail & _mask];
+
+                    if (cell.Sequence.load(std::memory_order_acquire) != _tail + 1) {
+                        break;
+                    }
+
+                    auto value = std::launder(reinterpret_cast<T *>(&cell.Storage));
+
+                    func(std::move(*value));
+                    value->~T();
+                    cell.Sequence.store(_tail + _mask + 1, std::memory_order_release);
+                    ++_tail;
+                    ++count;
+                }
+                return count;
+            }
+
+            std::size_t Capacity() const noexcept
+            {
+                return _mask + 1;
+            }
+
+            /**
+             * @brief Counts a discarded element, from any thread.
+             *
+             */
+            void Drop() noexcept
+            {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            std::size_t Dropped() const noexcept
+            {
+                return _dropped.load(std::memory_order_relaxed);
+            }
+
+        private:
+            struct Cell
+            {
+                std::atomic<std::size_t> Sequence{0};
+                std::aligned_storage_t<sizeof(T), alignof(T)> Storage;
+            };
+
+            std::unique_ptr<Cell[]> _cells;
+            std::size_t _mask{0};
+
+            alignas(CacheLineSize) std::atomic<std::size_t> _head{0};
+            std::atomic<std::size_t> _dropped{0};
+            /*! Only touched by the consumer */
+            alignas(CacheLineSize) std::size_t _tail{0};
+        };
+    }
+
+    /**
+     * @brief Hands subjects from any thread to the thread owning an `EventManager`.
+     *
+     * Each subject type has its own bounded lock-free queue,
+     * producers never take a lock and never contend with the consumer on the same counter.
+     * The consumer drains the queues into the event manager, which then delivers them by batch on `Dispatch`.
+     *
+     * @code
+     * // asio thread
+     * channel.Send<server::Walk>(walk);
+     * // game thread, once per frame
+     * channel.Drain(em);
+     * em.Dispatch();
+     * @endcode
+     *
+     * @tparam Subjects Types of the subjects carried by the channel.
+     */
+    template <typename ...Subjects>
+    class Channel
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity Maximum number of pending subjects of each type, rounded up to a power of two.
+         * @param overflow What producers do when a queue is full.
+         */
+        explicit Channel(std::size_t capacity = 1024, Overflow overflow = Overflow::Drop) :
+            _rings{(static_cast<void>(sizeof(Subjects)), capacity)...}, _overflow(overflow)
+        {}
+
+        ~Channel() = default;
+
+        Channel(const Channel &other) = delete;
+        Channel &operator=(const Channel &other) = delete;
+
+        /**
+         * @brief Sends a subject constructed from arguments, from any thread.
+         *
+         * @tparam Subject Type of the subject.
+         * @tparam Args Types of the arguments.
+         * @param args Arguments of the subject constructor, usually a subject to copy.
+         * @return False if the subject was dropped because its queue is full.
+         */
+        template <typename Subject, typename ...Args>
+        bool Send(Args &&...args)
+        {
+            auto &ring = Ring<Subject>();
+
+            while (!ring.TryPush(std::forward<Args>(args)...)) {
+                if (_overflow == Overflow::Drop) {
+                    ring.Drop();
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Moves pending subjects of every type into the queues of an event manager.
+         *
+         * Must be called from a single thread, the one owning the event manager.
+         * At most one queue capacity is drained per type, so producers cannot keep the consumer busy.
+         *
+         * @param em The event manager.
+         * @return The number of drained subjects.
+         */
+        std::size_t Drain(EventManager &em)
+        {
+            return (DrainSubject<Subjects>(em) + ... + 0);
+        }
+
+        /**
+         * @brief Gets the number of subjects dropped because their queue was full.
+         *
+         * @tparam Subject Type of the subject.
+         * @return The number of dropped subjects.
+         */
+        template <typename Subject>
+        std::size_t Dropped() const noexcept
+        {
+            return _rings.template Get<details::MpscRing<Subject>>().Dropped();
+        }
+
+    private:
+        template <typename Subject>
+        details::MpscRing<Subject> &Ring() noexcept
+        {
+            static_assert(meta::TupleHas<details::MpscRing<Subject>, meta::Tuple<details::MpscRing<Subjects>...>>::value,
+                          "Subject is not carried by this channel");
+            return _rings.template Get<details::MpscRing<Subject>>();
+        }
+
+        template <typename Subject>
+        std::size_t DrainSubject(EventManager &em)
+        {
+            auto &ring = Ring<Subject>();
+
+            return ring.Drain([&em](Subject &&args) {
+                em.Enqueue<Subject>(std::move(args));
+            }, ring.Capacity());
+        }
+
+    private:
+        meta::Tuple<details::MpscRing<Subjects>...> _rings;
+        Overflow _overflow;
+    };
+}
\ No newline at end of file
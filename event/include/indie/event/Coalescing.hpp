@@ -0,0 +1,186 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+namespace indie::event
+{
+    /**
+     * @brief Merge policy keeping the last queued subject of a key.
+     *
+     */
+    struct KeepLatest
+    {
+        template <typename Subject>
+        static void Merge(Subject &pending, Subject &&incoming)
+        {
+            pending = std::move(incoming);
+        }
+    };
+
+    /**
+     * @brief Merge policy adding queued subjects of a key with `operator+=`.
+     *
+     */
+    struct Accumulate
+    {
+        template <typename Subject>
+        static void Merge(Subject &pending, Subject &&incoming)
+        {
+            pending += std::move(incoming);
+        }
+    };
+
+    /**
+     * @brief Tells how queued subjects of a type are coalesced.
+     *
+     * Not coalesced by default. Specialize it to keep at most one pending subject per key,
+     * usually by inheriting `CoalesceBy`, or by providing a custom `Key` and `Merge`:
+     *
+     * @code
+     * template <>
+     * struct indie::event::Coalescing<Walk> : indie::event::CoalesceBy<&Walk::Player> {};
+     * @endcode
+     *
+     * @tparam Subject Type of the subject.
+     */
+    template <typename Subject>
+    struct Coalescing
+    {
+        static constexpr bool Enabled = false;
+    };
+
+    /**
+     * @brief Coalesces subjects by one of their members.
+     *
+     * @tparam Member Pointer to the member used as key.
+     * @tparam Policy Merge policy, `KeepLatest`, `Accumulate` or any type with a static `Merge(Subject &, Subject &&)`.
+     */
+    template <auto Member, typename Policy = KeepLatest>
+    struct CoalesceBy
+    {
+        static constexpr bool Enabled = true;
+
+        template <typename Subject>
+        static auto Key(const Subject &args) noexcept
+        {
+            return args.*Member;
+        }
+
+        template <typename Subject>
+        static void Merge(Subject &pending, Subject &&incoming)
+        {
+            Policy::Merge(pending, std::move(incoming));
+        }
+    };
+
+    namespace details
+    {
+        /**
+         * @brief Maps keys to positions in a queue, cleared once per dispatch.
+         *
+         * Open addressing with linear probing in a power of two table.
+         * Slots are stamped with a generation, clearing only bumps it so the table keeps its capacity
+         * and a steady flow of subjects does not allocate.
+         *
+         * @tparam KeyType Type of the keys.
+         */
+        template <typename KeyType>
+        class KeyIndex
+        {
+        public:
+            /**
+             * @brief Finds the position of a key, inserts it if missing.
+             *
+             * @param key The key.
+             * @param position Position stored if the key is missing.
+             * @return The position of the key, and true if it was inserted.
+             */
+            std::pair<std::size_t, bool> Emplace(const KeyType &key, std::size_t position)
+            {
+                // Kept under half full
+                if ((_size + 1) * 2 > _slots.size()) {
+                    Grow();
+                }
+
+                auto mask = _slots.size() - 1;
+
+                for (auto i = std::hash<KeyType>{}(key) & mask;; i = (i + 1) & mask) {
+                    auto &slot = _slots[i];
+
+                    if (slot.Generation != _generation) {
+                        slot = Slot{key, position, _generation};
+                        ++_size;
+                        return {position, true};
+                    }
+                    if (slot.Key == key) {
+                        return {slot.Position, false};
+                    }
+                }
+            }
+
+            void Clear() noexcept
+            {
+                _size = 0;
+                if (++_generation == 0) {
+                    // Wrapped, stale slots could look current
+                    for (auto &slot : _slots) {
+                        slot.Generation = 0;
+                    }
+                    _generation = 1;
+                }
+            }
+
+            std::size_t Size() const noexcept
+            {
+                return _size;
+            }
+
+        private:
+            struct Slot
+            {
+                KeyType Key{};
+                std::size_t Position{0};
+                /*! The slot is used if it matches the index generation */
+                std::uint32_t Generation{0};
+            };
+
+            void Grow()
+            {
+                auto old = std::move(_slots);
+
+                _slots.assign(old.empty() ? 16 : old.size() * 2, Slot{});
+                _size = 0;
+                for (auto &slot : old) {
+                    if (slot.Generation == _generation) {
+                        Emplace(slot.Key, slot.Position);
+                    }
+                }
+            }
+
+        private:
+            std::vector<Slot> _slots;
+            std::size_t _size{0};
+            std::uint32_t _generation{1};
+        };
+
+        /**
+         * @brief Key index of a coalesced subject, nothing otherwise.
+         *
+         */
+        template <typename Subject, bool = Coalescing<Subject>::Enabled>
+        struct CoalescingIndex
+        {};
+        template <typename Subject>
+        struct CoalescingIndex<Subject, true>
+        {
+            using KeyType = std::decay_t<decltype(Coalescing<Subject>::Key(std::declval<const Subject &>()))>;
+
+            KeyIndex<KeyType> Keys;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "SlotMap.hpp"
+
+namespace indie::event
+{
+    class EventManager;
+
+    /**
+     * @brief Token of a registration, returned by `EventManager::Register`.
+     *
+     * Disconnecting it removes the observer from the subjects of this registration in constant time,
+     * without searching for the observer. It stays a plain value: once disconnected,
+     * by the token or otherwise, it refers to nothing and never matches a later registration.
+     * See `ScopedConnection` to disconnect it automatically.
+     */
+    class Connection
+    {
+    public:
+        Connection() = default;
+
+    private:
+        friend class EventManager;
+
+        explicit Connection(details::SlotHandle handle) noexcept :
+            _handle(handle)
+        {}
+
+    private:
+        /*! First link of the registration in the event manager */
+        details::SlotHandle _handle;
+    };
+}
\ No newline at end of file
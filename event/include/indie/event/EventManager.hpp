@@ -1,23 +1,43 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
 
 #include "Observer.hpp"
+#include "Recorder.hpp"
+#include "SlotMap.hpp"
+#include "Connection.hpp"
 
 namespace indie::event
 {
     class EventManager
     {
     private:
+        friend class ParallelDispatcher;
+
         struct ObserverArrayData
         {
             using ObserverArrayId = std::size_t;
 
-            std::unique_ptr<std::vector<uintptr_t>> _pool;
+            /*! Arrays are destroyed through their real type */
+            std::unique_ptr<void, void (*)(void *)> _pool{nullptr, nullptr};
+            bool (*Unregister)(void *, const void *){nullptr};
+            bool (*Disconnect)(void *, details::SlotHandle){nullptr};
+            bool (*Connected)(const void *, details::SlotHandle){nullptr};
+            bool (*Has)(const void *, const void *){nullptr};
+            void (*Clear)(void *){nullptr};
+            void (*Dispatch)(void *, Recorder *){nullptr};
+            /*! Notifies a default constructed subject, null if the subject is not default constructible */
+            void (*NotifyDefault)(void *, Recorder *){nullptr};
 
             /**
              * @brief Generates a compile time unique identifier for an observers array.
-             * 
+             *
              * @tparam SubjectType Type of the subject handled by the array.
              * @return A unique array identifier.
              */
@@ -29,18 +49,70 @@ namespace indie::event
                 return id;
             }
 
+            /**
+             * @brief Builds the type-erased operations of an observers array.
+             *
+             * @tparam SubjectType Type of the subject handled by the array.
+             * @return Data of a new array.
+             */
+            template <typename SubjectType>
+            static ObserverArrayData Make()
+            {
+                using Type = ObserverArray<SubjectType>;
+
+                ObserverArrayData data;
+                data._pool = {new Type{}, [](void *pool) {
+                    delete static_cast<Type *>(pool);
+                }};
+                data.Unregister = [](void *pool, const void *observer) {
+                    return static_cast<Type *>(pool)->Unregister(observer);
+                };
+                data.Disconnect = [](void *pool, details::SlotHandle handle) {
+                    return static_cast<Type *>(pool)->Disconnect(handle);
+                };
+                data.Connected = [](const void *pool, details::SlotHandle handle) {
+                    return static_cast<const Type *>(pool)->Connected(handle);
+                };
+                data.Has = [](const void *pool, const void *observer) {
+                    return static_cast<const Type *>(pool)->Has(observer);
+                };
+                data.Clear = [](void *pool) {
+                    static_cast<Type *>(pool)->Clear();
+                };
+                data.Dispatch = [](void *pool, Recorder *recorder) {
+                    auto array = static_cast<Type *>(pool);
+
+                    array->Dispatch([array, recorder](Span<SubjectType> events) {
+                        if (recorder && array->Size() > 0) {
+                            recorder->Write(events, RecordKind::Dispatched);
+                        }
+                    });
+                };
+                if constexpr (std::is_default_constructible_v<SubjectType>) {
+                    data.NotifyDefault = [](void *pool, Recorder *recorder) {
+                        SubjectType args{};
+                        if (recorder && static_cast<Type *>(pool)->Size() > 0) {
+                            recorder->Write(args, RecordKind::Notified);
+                        }
+                        static_cast<Type *>(pool)->Notify(args);
+                    };
+                }
+                return data;
+            }
+
         private:
             /**
              * @brief Used by `GetArrayId()`
-             * 
+             *
              * Used to increment identifier at each call.
-             * 
+             *
              * @param reset If reset is set to true, the id counter is set to 0.
              * @return The current id counter.
              */
             static inline ObserverArrayId GenerateArrayId(bool reset = false) noexcept
             {
-                static ObserverArrayId cur{0};
+                // Managers may live on different threads
+                static std::atomic<ObserverArrayId> cur{0};
 
                 if (reset) {
                     cur = 0;
@@ -48,7 +120,7 @@ namespace indie::event
                 return cur++;
             }
         };
-    
+
     public:
         template <typename SubjectType>
         using ObserverPoolType = ObserverArray<SubjectType>;
@@ -63,45 +135,145 @@ namespace indie::event
         EventManager &operator=(EventManager &&other) = delete;
 
     private:
+        /**
+         * @brief Gets the observers of a subject.
+         *
+         * Returns `nullptr` if no observer ever registered to the subject.
+         *
+         * @tparam SubjectType Type of the subject.
+         * @return An immutable observers array.
+         */
         template <typename SubjectType>
         const ObserverPoolType<SubjectType> *GetObserverPool() const noexcept
         {
+            auto array_id = ObserverArrayData::template GetArrayId<SubjectType>();
+
+            if (array_id < _arrays.size()) {
+                return static_cast<const ObserverPoolType<SubjectType> *>(_arrays[array_id]._pool.get());
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Gets the observers of a subject.
+         * Allocates them if they do not exist.
+         *
+         * @tparam SubjectType Type of the subject.
+         * @return A mutable observers array.
+         */
+        template <typename SubjectType>
+        ObserverPoolType<SubjectType> *TryAllocateObserverPool()
+        {
+            auto array_id = ObserverArrayData::template GetArrayId<SubjectType>();
 
+            // Arrays are indexed by their identifier, some slots may stay empty
+            if (array_id >= _arrays.size()) {
+                _arrays.resize(array_id + 1);
+            }
+
+            auto &array = _arrays[array_id];
+
+            if (!array._pool) {
+                array = ObserverArrayData::template Make<SubjectType>();
+            }
+            return static_cast<ObserverPoolType<SubjectType> *>(array._pool.get());
         }
 
     public:
         /**
          * @brief Registers an observer to given subjects.
-         * 
+         *
+         * The observer receives each subject through its `OnReceive(Subject &)` method.
+         * The returned connection unregisters it from these subjects in constant time, see `Disconnect`.
+         *
          * @warning
          * If the observer is already watching for the desired subjects,
          * the behavior is undefined.
-         * 
+         *
          * @tparam Subject Type of the subject.
          * @tparam Subjects Type of the next subjects if exist.
          * @tparam ObserverType Type of the observer.
          * @param observer The observer object pointer/reference.
+         * @return The connection of the observer to these subjects.
          */
         template <typename Subject, typename ...Subjects, typename ObserverType>
-        void Register(ObserverType *observer) noexcept
+        Connection Register(ObserverType *observer)
         {
+            auto head = Connect<Subject>(observer, {});
+            [[maybe_unused]] auto tail = head;
 
+            ((tail = Connect<Subjects>(observer, tail)), ...);
+            return Connection{head};
         }
 
         /*! @copydoc EventManager::Register(ObserverType*) */
         template <typename Subject, typename ...Subjects, typename ObserverType>
-        void Register(ObserverType &observer) noexcept
+        Connection Register(ObserverType &observer)
         {
-            Register<Subject, Subjects...>(&observer);
+            return Register<Subject, Subjects...>(&observer);
+        }
+
+        /**
+         * @brief Unregisters the observer of a connection from the subjects it was registered to.
+         *
+         * Constant time for each subject, whatever the number of observers.
+         * If called during the delivery of one of these subjects,
+         * the observer receives nothing more and is erased once the delivery ends.
+         *
+         * @param connection The connection returned by `Register`.
+         * @return False if the connection was already disconnected.
+         */
+        bool Disconnect(Connection connection) noexcept
+        {
+            auto link = _links.Get(connection._handle);
+
+            if (!link || !link->Head) {
+                return false;
+            }
+
+            bool connected = false;
+
+            for (auto handle = connection._handle; (link = _links.Get(handle));) {
+                auto &array = _arrays[link->Array];
+                auto next = link->Next;
+
+                connected |= array.Disconnect(array._pool.get(), link->Observer);
+                _links.Erase(handle);
+                handle = next;
+            }
+            return connected;
+        }
+
+        /**
+         * @brief Tells if the observer of a connection is still registered to one of its subjects.
+         *
+         * @param connection The connection returned by `Register`.
+         * @return True if connected.
+         */
+        bool Connected(Connection connection) const noexcept
+        {
+            auto link = _links.Get(connection._handle);
+
+            if (!link || !link->Head) {
+                return false;
+            }
+            for (; link; link = _links.Get(link->Next)) {
+                auto &array = _arrays[link->Array];
+
+                if (array.Connected(array._pool.get(), link->Observer)) {
+                    return true;
+                }
+            }
+            return false;
         }
 
         /**
          * @brief Unregisters an observer from specified subjects.
-         * 
+         *
          * @warning
          * If the observer is not watching for the desired subjects,
          * the behavior is undefined.
-         * 
+         *
          * @tparam Subject Type of the subject.
          * @tparam Subjects Type of the next subjects if exist.
          * @tparam ObserverType Type of the observer.
@@ -110,29 +282,37 @@ namespace indie::event
         template <typename Subject, typename ...Subjects, typename ObserverType>
         void Unregister(ObserverType *observer) noexcept
         {
-
+            UnregisterFrom<Subject>(observer);
+            (UnregisterFrom<Subjects>(observer), ...);
+            EraseDisconnectedLinks();
         }
 
         /*! @copydoc EventManager::Unregister(ObserverType*) */
         template <typename Subject, typename ...Subjects, typename ObserverType>
         void Unregister(ObserverType &observer) noexcept
         {
-            Unregister<ObserverType, Subject, Subjects...>(&observer);
+            Unregister<Subject, Subjects...>(&observer);
         }
 
         /**
          * @brief Unregisters an observer from every subject it has subscribed to.
-         * 
+         *
          * If the observer is not subscribed to any subject,
          * this method will do nothing.
-         * 
-         * @tparam ObserverType 
-         * @param observer 
+         * It searches every subject, prefer `Disconnect` for frequent unregistrations.
+         *
+         * @tparam ObserverType
+         * @param observer
          */
         template <typename ObserverType>
         void Unregister(ObserverType *observer) noexcept
         {
-
+            for (auto &array : _arrays) {
+                if (array._pool) {
+                    array.Unregister(array._pool.get(), observer);
+                }
+            }
+            EraseDisconnectedLinks();
         }
 
         /*! @copydoc EventManager::Unregister(ObserverType*) */
@@ -144,47 +324,164 @@ namespace indie::event
 
         /**
          * @brief Notifies observers registered to given subjects.
-         * 
+         *
          * @note
          * The observer should be watching to every given subject to be notified.
-         * 
+         *
          * @tparam Subject Type of the first subject.
          * @tparam Subjects Type of the next subjects, if exist.
          * @param args Argument to pass to observers callback.
          */
-        template <typename Subject, typename ...Subjects> const
-        void Notify(Subject &args)
+        template <typename Subject, typename ...Subjects>
+        void Notify(Subject &args) const
         {
-            if constexpr(sizeof...(Subjects) >= 1) {
-                Notify<Subjects...>(args);
+            auto pool = GetObserverPool<Subject>();
+
+            if (!pool) {
+                return;
+            }
+            if (_recorder && pool->Size() > 0) {
+                _recorder->Write(args, RecordKind::Notified);
+            }
+            // Notifying defers the removals made by observers, the array is mutable
+            auto array = const_cast<ObserverPoolType<Subject> *>(pool);
+
+            if constexpr (sizeof...(Subjects) == 0) {
+                array->Notify(args);
+            }
+            else {
+                array->NotifyIf(args, [this](const void *observer) {
+                    return Has<Subjects...>(observer);
+                });
             }
         }
 
         /**
          * @brief Notifies all observers on all subjects.
-         * 
+         *
+         * Without argument, observers of every default constructible subject receive a default constructed subject.
+         * Otherwise, each argument is notified to the observers of its type.
          */
         template <typename ...Args>
         void Notify(Args &&...args) const
         {
+            if constexpr (sizeof...(Args) == 0) {
+                for (auto &array : _arrays) {
+                    if (array._pool && array.NotifyDefault) {
+                        array.NotifyDefault(array._pool.get(), _recorder);
+                    }
+                }
+            }
+            else {
+                (Notify<std::remove_reference_t<Args>>(args), ...);
+            }
+        }
 
+        /**
+         * @brief Queues a subject, delivered to its observers by the next `Dispatch`.
+         *
+         * Unlike `Notify`, no observer code runs until the dispatch,
+         * subjects of a type are stored contiguously and delivered as a batch.
+         * If the subject is coalesced, it is merged with the queued subject of the same key, see `Coalescing`.
+         *
+         * @tparam Subject Type of the subject.
+         * @tparam Args Types of the arguments.
+         * @param args Arguments of the subject constructor, usually a subject to copy.
+         */
+        template <typename Subject, typename ...Args>
+        void Enqueue(Args &&...args)
+        {
+            TryAllocateObserverPool<Subject>()->Enqueue(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Delivers queued subjects of given types, or of every type without template argument.
+         *
+         * Subjects are delivered type by type, in queuing order within a type.
+         * Observers receive the whole batch through `OnReceive(Span<Subject>)` if they have it,
+         * one subject at a time otherwise.
+         * Subjects queued by observers during the dispatch are delivered by the next one.
+         *
+         * @tparam Subjects Types of the subjects.
+         */
+        template <typename ...Subjects>
+        void Dispatch()
+        {
+            if constexpr (sizeof...(Subjects) == 0) {
+                // Indexed, observers may register to new subjects
+                for (std::size_t i = 0; i < _arrays.size(); ++i) {
+                    if (_arrays[i]._pool) {
+                        _arrays[i].Dispatch(_arrays[i]._pool.get(), _recorder);
+                    }
+                }
+            }
+            else {
+                (DispatchSubject<Subjects>(), ...);
+            }
+        }
+
+        /**
+         * @brief Gets the number of subjects waiting for the next dispatch.
+         *
+         * @tparam Subject Type of the subject.
+         * @return The number of queued subjects.
+         */
+        template <typename Subject>
+        std::size_t Queued() const noexcept
+        {
+            auto pool = GetObserverPool<Subject>();
+
+            return pool ? pool->Queued() : 0;
+        }
+
+        /**
+         * @brief Gets the number of subjects merged into a queued one since the last dispatch.
+         *
+         * Always 0 if the subject is not coalesced, see `Coalescing`.
+         *
+         * @tparam Subject Type of the subject.
+         * @return The number of coalesced subjects.
+         */
+        template <typename Subject>
+        std::size_t Coalesced() const noexcept
+        {
+            auto pool = GetObserverPool<Subject>();
+
+            return pool ? pool->Coalesced() : 0;
+        }
+
+        /**
+         * @brief Writes every notified or dispatched subject to a recorder.
+         *
+         * Subjects without observers are not delivered, so not recorded either:
+         * queued subjects are dropped by the dispatch if no observer is registered by then.
+         *
+         * @param recorder The recorder, null to stop recording.
+         */
+        void Record(Recorder *recorder) noexcept
+        {
+            _recorder = recorder;
         }
 
         /**
          * @brief Removes observers from given subjects.
-         * 
+         *
          * @tparam Subject Type of the subject.
          * @tparam Subjects Type of the next subjects, if exist.
          */
         template <typename Subject, typename ...Subjects>
         void Reset() noexcept
         {
-
+            ResetSubject<Subject>();
+            (ResetSubject<Subjects>(), ...);
+            EraseDisconnectedLinks();
         }
 
         /**
          * @brief Tells if an observer is watching for given subjects.
-         * 
+         *
+         * Without subject, tells if the observer is watching for any subject.
+         *
          * @tparam Subjects Type of the subjects.
          * @tparam ObserverType Type of the observer.
          * @param observer The observer object pointer/reference
@@ -193,9 +490,19 @@ namespace indie::event
         template <typename ...Subjects, typename ObserverType>
         bool Has(ObserverType *observer) const noexcept
         {
-            return false;
+            if constexpr (sizeof...(Subjects) == 0) {
+                for (auto &array : _arrays) {
+                    if (array._pool && array.Has(array._pool.get(), observer)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            else {
+                return (HasSubject<Subjects>(observer) && ...);
+            }
         }
-        
+
         /*! @copydoc EventManager::Has(ObserverType*) */
         template <typename ...Subjects, typename ObserverType>
         bool Has(ObserverType &observer) const noexcept
@@ -204,5 +511,114 @@ namespace indie::event
         }
 
     private:
+        /**
+         * @brief Registers an observer to a subject and links the registration to the previous one.
+         *
+         * @tparam Subject Type of the subject.
+         * @param observer The observer object pointer.
+         * @param previous Link of the previous subject of the registration, invalid for the first one.
+         * @return The link of this subject.
+         */
+        template <typename Subject, typename ObserverType>
+        details::SlotHandle Connect(ObserverType *observer, details::SlotHandle previous)
+        {
+            auto pool = TryAllocateObserverPool<Subject>();
+            auto handle = pool->Register(observer);
+            auto head = previous.Index == details::SlotHandle::Invalid;
+            auto link = _links.Emplace(Link{ObserverArrayData::template GetArrayId<Subject>(), handle, {}, head});
+
+            if (!head) {
+                _links.Get(previous)->Next = link;
+            }
+            return link;
+        }
+
+        /**
+         * @brief Erases the links of registrations whose observer is unregistered from every subject
+         * without `Disconnect`, so dropped connections do not pile up.
+         *
+         * Runs once the links doubled since the last run, its cost is spread over the registrations.
+         */
+        void EraseDisconnectedLinks() noexcept
+        {
+            if (_links.Size() < 2 * _links_kept) {
+                return;
+            }
+            // Backwards, erasing moves the last links, already visited, into the freed places
+            for (auto i = _links.Size(); i-- > 0;) {
+                if (i >= _links.Size() || !_links[i].Head) {
+                    continue;
+                }
+
+                auto head = _links.HandleAt(i);
+
+                if (!Connected(Connection{head})) {
+                    Disconnect(Connection{head});
+                }
+            }
+            _links_kept = std::max<std::size_t>(_links.Size(), MinLinksKept);
+        }
+
+        template <typename Subject>
+        void UnregisterFrom(const void *observer) noexcept
+        {
+            if (auto pool = GetObserverPool<Subject>()) {
+                const_cast<ObserverPoolType<Subject> *>(pool)->Unregister(observer);
+            }
+        }
+
+        template <typename Subject>
+        void ResetSubject() noexcept
+        {
+            if (auto pool = GetObserverPool<Subject>()) {
+                const_cast<ObserverPoolType<Subject> *>(pool)->Clear();
+            }
+        }
+
+        template <typename Subject>
+        void DispatchSubject()
+        {
+            if (auto pool = GetObserverPool<Subject>()) {
+                const_cast<ObserverPoolType<Subject> *>(pool)->Dispatch([this, pool](Span<Subject> events) {
+                    if (_recorder && pool->Size() > 0) {
+                        _recorder->Write(events, RecordKind::Dispatched);
+                    }
+                });
+            }
+        }
+
+        template <typename Subject>
+        bool HasSubject(const void *observer) const noexcept
+        {
+            auto pool = GetObserverPool<Subject>();
+
+            return pool && pool->Has(observer);
+        }
+
+    private:
+        static constexpr std::size_t MinLinksKept = 32;
+
+        /**
+         * @brief Registration of an observer to one subject, chained to the other subjects of the same `Register` call.
+         *
+         */
+        struct Link
+        {
+            ObserverArrayData::ObserverArrayId Array;
+            /*! Registration handle in the observers array */
+            details::SlotHandle Observer;
+            details::SlotHandle Next;
+            /*! First link of the registration, the one referenced by its connection */
+            bool Head;
+        };
+
+        /*! Observers of each subject, indexed by array identifier */
+        std::vector<ObserverArrayData> _arrays;
+        /*! Links of the connections */
+        details::SlotMap<Link> _links;
+        /*! Links left by the last `EraseDisconnectedLinks` run */
+        std::size_t _links_kept{MinLinksKept};
+        /*! Receives delivered subjects, null if not recording */
+        Recorder *_recorder{nullptr};
     };
 }
\ No newline at end of file
@@ -1,50 +1,500 @@
 #pragma once
 
 #include <vector>
-#include <functional>
-#include <cstdint>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include "Span.hpp"
+#include "SlotMap.hpp"
+#include "Coalescing.hpp"
 
 namespace indie::event
 {
+    namespace details
+    {
+        /**
+         * @brief Tells if `T::OnReceive` accepts an argument of type `Arg`.
+         *
+         */
+        template <typename T, typename Arg, typename = void>
+        struct CanReceive : std::false_type
+        {};
+        template <typename T, typename Arg>
+        struct CanReceive<T, Arg, std::void_t<decltype(std::declval<T &>().OnReceive(std::declval<Arg>()))>> : std::true_type
+        {};
+    }
+
+    /**
+     * @brief Non-allocating delegate calling `OnReceive` on an object.
+     *
+     * Holds the object pointer and thunks to the member functions, it is trivially copyable
+     * and calling it costs one indirect call.
+     *
+     * The object receives a subject through `OnReceive(SubjectType &)`,
+     * and queued subjects through `OnReceive(Span<SubjectType>)` if it has such an overload,
+     * one at a time otherwise.
+     *
+     * @tparam SubjectType Type of the subject received.
+     */
     template <typename SubjectType>
     class Observer
     {
     public:
-        using CallbackType = std::function<void(SubjectType &)>;
+        Observer() = default;
 
-    public:
-        explicit Observer(CallbackType callback) noexcept :
-            _callback(callback)
-        {}
+        /**
+         * @brief Binds an object receiving the subject through its `OnReceive` method.
+         *
+         * @tparam TObserver Type of the object.
+         * @param observer The object, must outlive the delegate.
+         * @return The delegate.
+         */
+        template <typename TObserver>
+        static Observer Bind(TObserver *observer) noexcept
+        {
+            constexpr bool single = details::CanReceive<TObserver, SubjectType &>::value;
+            constexpr bool batch = details::CanReceive<TObserver, Span<SubjectType>>::value;
+            static_assert(single || batch, "Observer must have an OnReceive(SubjectType &) or OnReceive(Span<SubjectType>) method");
+
+            Observer delegate;
+
+            delegate._object = observer;
+            if constexpr (single) {
+                delegate._thunk = [](void *object, SubjectType &args) {
+                    static_cast<TObserver *>(object)->OnReceive(args);
+                };
+            }
+            else {
+                delegate._thunk = [](void *object, SubjectType &args) {
+                    static_cast<TObserver *>(object)->OnReceive(Span<SubjectType>{&args, 1});
+                };
+            }
+            if constexpr (batch) {
+                delegate._batch = [](void *object, Span<SubjectType> events) {
+                    static_cast<TObserver *>(object)->OnReceive(events);
+                };
+            }
+            return delegate;
+        }
 
         void operator()(SubjectType &args) const
         {
-            _callback(args);
+            _thunk(_object, args);
+        }
+
+        /**
+         * @brief Delivers a batch of subjects at once, the object must accept spans.
+         *
+         * @param events The subjects.
+         */
+        void operator()(Span<SubjectType> events) const
+        {
+            _batch(_object, events);
+        }
+
+        /**
+         * @brief Tells if the object receives batches at once, through `OnReceive(Span<SubjectType>)`.
+         *
+         * @return True if batches may be given to the delegate.
+         */
+        bool Batched() const noexcept
+        {
+            return _batch != nullptr;
+        }
+
+        /**
+         * @brief Gets the bound object.
+         *
+         * @return The object pointer.
+         */
+        const void *Object() const noexcept
+        {
+            return _object;
+        }
+
+        /**
+         * @brief Turns the delegate into a no-op, its object becomes null.
+         *
+         */
+        void Disable() noexcept
+        {
+            _object = nullptr;
+            _thunk = [](void *, SubjectType &) {};
+            _batch = [](void *, Span<SubjectType>) {};
         }
 
     private:
-        CallbackType _callback;
+        void *_object{nullptr};
+        void (*_thunk)(void *, SubjectType &){nullptr};
+        /*! Null if the object does not accept spans */
+        void (*_batch)(void *, Span<SubjectType>){nullptr};
     };
 
+    /**
+     * @brief Observers of a subject, stored contiguously, and the subjects queued for them.
+     *
+     * Observers live in a slot map: each registration gets a handle removing it in constant time.
+     * They are notified in registration order until one is removed, the last one takes its place.
+     * An observer removed while the array delivers is disabled at once and erased when the delivery ends,
+     * so the delivery neither skips nor repeats an observer.
+     *
+     * Queued subjects are stored contiguously, in two buffers swapped on dispatch:
+     * subjects queued while a batch is delivered wait for the next dispatch,
+     * and both buffers keep their capacity so a steady flow of subjects does not allocate.
+     * If the subject is coalesced, at most one subject per key waits in the queue,
+     * at the position of the first subject queued with this key.
+     *
+     * @tparam SubjectType Type of the subject.
+     */
     template <typename SubjectType>
-    class ObserverArray : std::vector<uintptr_t>
+    class ObserverArray
     {
     public:
         using ObserverType = Observer<SubjectType>;
 
     public:
+        /**
+         * @brief Adds an observer.
+         *
+         * @tparam TObserver Type of the observer.
+         * @param observer The observer object pointer.
+         * @return The handle of the registration, see `Disconnect`.
+         */
         template <typename TObserver>
-        void Register(TObserver *observer)
+        details::SlotHandle Register(TObserver *observer)
+        {
+            return _observers.Emplace(ObserverType::Bind(observer));
+        }
+
+        /**
+         * @brief Removes an observer by its registration handle, in constant time.
+         *
+         * @param handle The handle returned by `Register`.
+         * @return False if the observer was already removed.
+         */
+        bool Disconnect(details::SlotHandle handle) noexcept
+        {
+            if (!Connected(handle)) {
+                return false;
+            }
+            Remove(handle);
+            return true;
+        }
+
+        /**
+         * @brief Tells if a registration handle still refers to an observer.
+         *
+         * @param handle The handle returned by `Register`.
+         * @return True if the observer is registered.
+         */
+        bool Connected(details::SlotHandle handle) const noexcept
+        {
+            auto registered = _observers.Get(handle);
+
+            return registered && registered->Object();
+        }
+
+        /**
+         * @brief Removes an observer by its object pointer.
+         *
+         * @param observer The observer object pointer.
+         * @return True if the observer was registered.
+         */
+        bool Unregister(const void *observer) noexcept
         {
+            for (std::size_t i = 0; i < _observers.Size(); ++i) {
+                if (_observers[i].Object() == observer) {
+                    Remove(_observers.HandleAt(i));
+                    return true;
+                }
+            }
+            return false;
+        }
 
+        bool Has(const void *observer) const noexcept
+        {
+            return std::any_of(_observers.begin(), _observers.end(), [observer](const ObserverType &registered) {
+                return registered.Object() == observer;
+            });
         }
 
+        /**
+         * @brief Calls every observer.
+         *
+         * Observers registered by a callback are notified too.
+         *
+         * @param args Argument passed to the observers.
+         */
         void Notify(SubjectType &args)
         {
+            Delivery delivery{*this};
 
+            // Indexed, a callback may register observers
+            for (std::size_t i = 0; i < _observers.Size(); ++i) {
+                _observers[i](args);
+            }
+        }
+
+        /**
+         * @brief Calls the observers accepted by a predicate.
+         *
+         * @tparam Predicate Type of the predicate.
+         * @param args Argument passed to the observers.
+         * @param predicate Function receiving each observer object pointer.
+         */
+        template <typename Predicate>
+        void NotifyIf(SubjectType &args, Predicate &&predicate)
+        {
+            Delivery delivery{*this};
+
+            for (std::size_t i = 0; i < _observers.Size(); ++i) {
+                if (_observers[i].Object() && predicate(_observers[i].Object())) {
+                    _observers[i](args);
+                }
+            }
+        }
+
+        /**
+         * @brief Queues a subject, constructed from arguments.
+         *
+         * @tparam Args Types of the arguments.
+         * @param args Arguments of the subject constructor.
+         */
+        template <typename ...Args>
+        void Enqueue(Args &&...args)
+        {
+            if constexpr (Coalescing<SubjectType>::Enabled) {
+                SubjectType subject{std::forward<Args>(args)...};
+                auto [position, inserted] = _coalescing.Keys.Emplace(Coalescing<SubjectType>::Key(subject), _queued.size());
+
+                if (inserted) {
+                    _queued.push_back(std::move(subject));
+                }
+                else {
+                    Coalescing<SubjectType>::Merge(_queued[position], std::move(subject));
+                    ++_coalesced;
+                }
+            }
+            else {
+                _queued.push_back(SubjectType{std::forward<Args>(args)...});
+            }
+        }
+
+        /**
+         * @brief Delivers the queued subjects to every observer, batch by batch.
+         *
+         * Does nothing if called from an observer of the batch being delivered.
+         */
+        void Dispatch()
+        {
+            Dispatch([](Span<SubjectType>) {});
+        }
+
+        /**
+         * @brief Delivers the queued subjects to a function then to every observer.
+         *
+         * @tparam Func Type of the function.
+         * @param deliver Function receiving the batch before the observers.
+         */
+        template <typename Func>
+        void Dispatch(Func &&deliver)
+        {
+            auto events = Acquire();
+
+            if (events.Empty()) {
+                return;
+            }
+
+            // Released even if an observer throws, the array would stay dispatching otherwise
+            struct Releaser
+            {
+                ~Releaser()
+                {
+                    array.Release();
+                }
+
+                ObserverArray &array;
+            } releaser{*this};
+
+            deliver(events);
+            Deliver(events);
+        }
+
+        /**
+         * @brief Takes the queued subjects to deliver them with `Deliver`, possibly from other threads.
+         *
+         * Until `Release`, the array is dispatching: subjects queued meanwhile wait for the next batch.
+         *
+         * @return The batch, empty if there is nothing to deliver or if the array is already dispatching.
+         */
+        Span<SubjectType> Acquire()
+        {
+            if (_dispatching || _queued.empty()) {
+                return {};
+            }
+
+            _dispatching = true;
+            std::swap(_queued, _batch);
+            if constexpr (Coalescing<SubjectType>::Enabled) {
+                _coalesced = 0;
+                _coalescing.Keys.Clear();
+            }
+            return {_batch.data(), _batch.size()};
+        }
+
+        /**
+         * @brief Delivers subjects to every observer.
+         *
+         * Only reads the observers, so it may run on several threads at once
+         * as long as no observer is registered or unregistered meanwhile.
+         *
+         * @param events The subjects.
+         */
+        void Deliver(Span<SubjectType> events) const
+        {
+            for (std::size_t i = 0; i < _observers.Size(); ++i) {
+                if (_observers[i].Batched()) {
+                    _observers[i](events);
+                    continue;
+                }
+                // Indexed at each subject, a callback may register observers or remove this one
+                for (auto &args : events) {
+                    _observers[i](args);
+                }
+            }
+        }
+
+        /**
+         * @brief Ends the delivery of the batch taken by `Acquire`.
+         *
+         * Observers removed during the delivery are erased.
+         */
+        void Release() noexcept
+        {
+            _batch.clear();
+            _dispatching = false;
+            if (!_notifying) {
+                EraseRemoved();
+            }
+        }
+
+        /**
+         * @brief Gets the number of subjects waiting for the next dispatch.
+         *
+         * @return The number of queued subjects.
+         */
+        std::size_t Queued() const noexcept
+        {
+            return _queued.size();
+        }
+
+        /**
+         * @brief Gets the number of subjects merged into a queued one since the last dispatch.
+         *
+         * @return The number of coalesced subjects.
+         */
+        std::size_t Coalesced() const noexcept
+        {
+            return _coalesced;
+        }
+
+        /**
+         * @brief Removes every observer.
+         *
+         * During a delivery, the observers are disabled at once and erased once it ends.
+         */
+        void Clear() noexcept
+        {
+            if (_notifying || _dispatching) {
+                for (std::size_t i = 0; i < _observers.Size(); ++i) {
+                    // Null objects were already removed
+                    if (_observers[i].Object()) {
+                        _observers[i].Disable();
+                        _removed.push_back(_observers.HandleAt(i));
+                    }
+                }
+                return;
+            }
+            _observers.Clear();
+            _removed.clear();
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return _observers.Size() - _removed.size();
+        }
+
+        /**
+         * @brief Iterates the observers, those removed during the current delivery included, with a null object.
+         *
+         */
+        typename std::vector<ObserverType>::const_iterator begin() const noexcept
+        {
+            return _observers.begin();
+        }
+
+        typename std::vector<ObserverType>::const_iterator end() const noexcept
+        {
+            return _observers.end();
+        }
+
+    private:
+        /**
+         * @brief Marks a notification in progress, removals are deferred meanwhile.
+         *
+         */
+        struct Delivery
+        {
+            explicit Delivery(ObserverArray &array) noexcept :
+                array(array)
+            {
+                ++array._notifying;
+            }
+
+            ~Delivery()
+            {
+                if (--array._notifying == 0 && !array._removed.empty() && !array._dispatching) {
+                    array.EraseRemoved();
+                }
+            }
+
+            ObserverArray &array;
+        };
+
+        void Remove(details::SlotHandle handle) noexcept
+        {
+            if (_notifying || _dispatching) {
+                _observers.Get(handle)->Disable();
+                _removed.push_back(handle);
+            }
+            else {
+                _observers.Erase(handle);
+            }
+        }
+
+        void EraseRemoved() noexcept
+        {
+            for (auto handle : _removed) {
+                _observers.Erase(handle);
+            }
+            _removed.clear();
         }
 
     private:
-        std::vector<ObserverType> _observers;
+        details::SlotMap<ObserverType> _observers;
+        /*! Observers removed during the current delivery, erased once it ends */
+        std::vector<details::SlotHandle> _removed;
+        /*! Depth of nested notifications */
+        std::size_t _notifying{0};
+
+        std::vector<SubjectType> _queued;
+        /*! Subjects being delivered */
+        std::vector<SubjectType> _batch;
+        bool _dispatching{false};
+        /*! Positions of the queued subjects by key, if the subject is coalesced */
+        details::CoalescingIndex<SubjectType> _coalescing;
+        std::size_t _coalesced{0};
     };
 }
\ No newline at end of file
@@ -0,0 +1,373 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+#include "EventManager.hpp"
+
+namespace indie::event
+{
+    /**
+     * @brief Tells how the subjects of a type are spread over the lanes of a `ParallelDispatcher`.
+     *
+     * By default a type is a single lane, delivered in queuing order.
+     * Specialize it, usually by inheriting `LaneBy`, to spread subjects over several lanes by key:
+     * subjects of a key keep their order, subjects of different keys may be delivered concurrently.
+     *
+     * @code
+     * template <>
+     * struct indie::event::Lanes<Analytics> : indie::event::LaneBy<&Analytics::Player> {};
+     * @endcode
+     *
+     * @tparam Subject Type of the subject.
+     */
+    template <typename Subject>
+    struct Lanes
+    {
+        static constexpr bool Keyed = false;
+    };
+
+    /**
+     * @brief Spreads subjects over lanes by one of their members.
+     *
+     * @tparam Member Pointer to the member used as key, hashable.
+     */
+    template <auto Member>
+    struct LaneBy
+    {
+        static constexpr bool Keyed = true;
+
+        template <typename Subject>
+        static auto Key(const Subject &args) noexcept
+        {
+            return args.*Member;
+        }
+    };
+
+    namespace details
+    {
+        /**
+         * @brief Fixed set of threads running submitted tasks.
+         *
+         * Without worker, tasks run on the submitting thread.
+         */
+        class WorkerPool
+        {
+        public:
+            explicit WorkerPool(std::size_t workers)
+            {
+                for (std::size_t i = 0; i < workers; ++i) {
+                    _threads.emplace_back([this] {
+                        Work();
+                    });
+                }
+            }
+
+            ~WorkerPool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    _stop = true;
+                }
+                _ready.notify_all();
+                for (auto &thread : _threads) {
+                    thread.join();
+                }
+            }
+
+            WorkerPool(const WorkerPool &other) = delete;
+            WorkerPool &operator=(const WorkerPool &other) = delete;
+
+            void Submit(std::function<void()> task)
+            {
+                if (_threads.empty()) {
+                    Run(task);
+                    return;
+                }
+                {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    _tasks.push_back(std::move(task));
+                    ++_pending;
+                }
+                _ready.notify_one();
+            }
+
+            /**
+             * @brief Waits for every submitted task.
+             *
+             * Rethrows the first exception thrown by a task since the last wait.
+             */
+            void Wait()
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+
+                _done.wait(lock, [this] {
+                    return _pending == 0;
+                });
+                if (_error) {
+                    std::rethrow_exception(std::exchange(_error, nullptr));
+                }
+            }
+
+            std::size_t Workers() const noexcept
+            {
+                return _threads.size();
+            }
+
+        private:
+            void Work()
+            {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock{_mutex};
+
+                        _ready.wait(lock, [this] {
+                            return _stop || !_tasks.empty();
+                        });
+                        if (_tasks.empty()) {
+                            return;
+                        }
+                        task = std::move(_tasks.front());
+                        _tasks.pop_front();
+                    }
+                    Run(task);
+
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    if (--_pending == 0) {
+                        _done.notify_all();
+                    }
+                }
+            }
+
+            void Run(std::function<void()> &task) noexcept
+            {
+                try {
+                    task();
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    if (!_error) {
+                        _error = std::current_exception();
+                    }
+                }
+            }
+
+        private:
+            std::mutex _mutex;
+            std::condition_variable _ready;
+            std::condition_variable _done;
+            std::deque<std::function<void()>> _tasks;
+            std::size_t _pending{0};
+            bool _stop{false};
+            std::exception_ptr _error;
+            std::vector<std::thread> _threads;
+        };
+    }
+
+    /**
+     * @brief Delivers queued subjects of an event manager on worker threads.
+     *
+     * Each subject type is a lane, or several if it is keyed through `Lanes`.
+     * Subjects of a lane are delivered in queuing order by a single task,
+     * different lanes run in parallel. `Dispatch` returns once the tasks are submitted,
+     * the calling thread may keep working until `Flush`.
+     *
+     * Between `Dispatch` and `Flush`:
+     * - observers of the dispatched subjects run concurrently and must be thread-safe for each other,
+     * - subjects may be queued, they wait for the next dispatch,
+     * - observers must not be registered nor unregistered, and the dispatched subjects
+     *   are skipped by any other dispatch.
+     *
+     * Example:
+     * @code
+     * indie::event::ParallelDispatcher parallel{em};
+     * parallel.Dispatch<AudioCue, Analytics>();
+     * em.Dispatch<Walk>();
+     * parallel.Flush();
+     * @endcode
+     */
+    class ParallelDispatcher
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param em The event manager, must outlive the dispatcher.
+         * @param workers Number of worker threads, subjects are delivered by the calling thread if 0.
+         * @param lanes Number of lanes of keyed subject types, the number of workers if 0.
+         */
+        explicit ParallelDispatcher(EventManager &em, std::size_t workers = std::thread::hardware_concurrency(), std::size_t lanes = 0) :
+            _em(em), _workers(workers), _lanes(lanes ? lanes : (workers ? workers : 1))
+        {}
+
+        /**
+         * @brief Destructor, waits for the dispatched subjects.
+         *
+         * Exceptions thrown by observers are lost, call `Flush` to get them.
+         */
+        ~ParallelDispatcher()
+        {
+            try {
+                Flush();
+            }
+            catch (...) {
+            }
+        }
+
+        ParallelDispatcher(const ParallelDispatcher &other) = delete;
+        ParallelDispatcher &operator=(const ParallelDispatcher &other) = delete;
+
+        /**
+         * @brief Starts the delivery of queued subjects of given types.
+         *
+         * @tparam Subject Type of the first subject.
+         * @tparam Subjects Types of the next subjects, if exist.
+         */
+        template <typename Subject, typename ...Subjects>
+        void Dispatch()
+        {
+            Start<Subject>();
+            (Start<Subjects>(), ...);
+        }
+
+        /**
+         * @brief Waits for the end of every delivery started by `Dispatch`.
+         *
+         * Rethrows the first exception thrown by an observer.
+         */
+        void Flush()
+        {
+            std::exception_ptr error;
+
+            try {
+                _workers.Wait();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            for (auto &batch : _batches) {
+                batch.Release(batch.Array, batch.Lanes);
+            }
+            _batches.clear();
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        /**
+         * @brief Gets the number of worker threads.
+         *
+         * @return The number of workers, 0 if subjects are delivered by the calling thread.
+         */
+        std::size_t Workers() const noexcept
+        {
+            return _workers.Workers();
+        }
+
+    private:
+        template <typename Subject>
+        using LaneBuffers = std::vector<std::vector<Subject>>;
+
+        /**
+         * @brief Batch being delivered, released by `Flush`.
+         *
+         */
+        struct Batch
+        {
+            void *Array;
+            void *Lanes;
+            void (*Release)(void *, void *);
+        };
+
+        template <typename Subject>
+        void Start()
+        {
+            auto array = const_cast<ObserverArray<Subject> *>(_em.GetObserverPool<Subject>());
+
+            if (!array) {
+                return;
+            }
+
+            auto events = array->Acquire();
+
+            if (events.Empty()) {
+                return;
+            }
+            if (_em._recorder) {
+                _em._recorder->Write(events, RecordKind::Dispatched);
+            }
+
+            if constexpr (!Lanes<Subject>::Keyed) {
+                _batches.push_back(Batch{array, nullptr, [](void *array, void *) {
+                    static_cast<ObserverArray<Subject> *>(array)->Release();
+                }});
+                _workers.Submit([array, events] {
+                    array->Deliver(events);
+                });
+            }
+            else {
+                auto &lanes = Buffers<Subject>();
+
+                _batches.push_back(Batch{array, &lanes, [](void *array, void *lanes) {
+                    for (auto &lane : *static_cast<LaneBuffers<Subject> *>(lanes)) {
+                        lane.clear();
+                    }
+                    static_cast<ObserverArray<Subject> *>(array)->Release();
+                }});
+                // Partitioned on the calling thread, each lane keeps the queuing order of its keys
+                for (auto &args : events) {
+                    auto key = Lanes<Subject>::Key(args);
+
+                    lanes[std::hash<decltype(key)>{}(key) % lanes.size()].push_back(args);
+                }
+                for (auto &lane : lanes) {
+                    if (!lane.empty()) {
+                        _workers.Submit([array, lane = &lane] {
+                            array->Deliver(Span<Subject>{lane->data(), lane->size()});
+                        });
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Gets the lane buffers of a keyed subject, kept between dispatches to reuse their capacity.
+         *
+         * @tparam Subject Type of the subject.
+         * @return The buffers, one per lane.
+         */
+        template <typename Subject>
+        LaneBuffers<Subject> &Buffers()
+        {
+            auto id = EventManager::ObserverArrayData::template GetArrayId<Subject>();
+
+            while (id >= _buffers.size()) {
+                _buffers.emplace_back(nullptr, nullptr);
+            }
+            if (!_buffers[id]) {
+                _buffers[id] = {new LaneBuffers<Subject>(_lanes), [](void *buffers) {
+                    delete static_cast<LaneBuffers<Subject> *>(buffers);
+                }};
+            }
+            return *static_cast<LaneBuffers<Subject> *>(_buffers[id].get());
+        }
+
+    private:
+        EventManager &_em;
+        details::WorkerPool _workers;
+        std::size_t _lanes;
+
+        std::vector<Batch> _batches;
+        /*! Lane buffers of keyed subjects, indexed by array identifier */
+        std::vector<std::unique_ptr<void, void (*)(void *)>> _buffers;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <new>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <utility>
+
+namespace indie::event
+{
+    template <typename T>
+    class PayloadPool;
+
+    namespace details
+    {
+        /**
+         * @brief Storage of a pooled payload, with its reference count.
+         *
+         * @tparam T Type of the payload.
+         */
+        template <typename T>
+        struct PayloadNode
+        {
+            alignas(T) unsigned char Storage[sizeof(T)];
+            /*! Payload constructed in the storage, kept rather than laundered so reads are not reloaded */
+            T *Value;
+            std::size_t References;
+            PayloadPool<T> *Pool;
+            /*! Next free node, while in the free list */
+            PayloadNode *Next;
+        };
+    }
+
+    /**
+     * @brief Counted reference to a payload of a `PayloadPool`.
+     *
+     * Copying it only copies a pointer, so a subject carrying a large payload
+     * is queued and kept by observers without copying the payload.
+     * The payload goes back to its pool when the last reference is dropped,
+     * usually when the dispatched batch is cleared.
+     *
+     * References must stay on the thread of their pool.
+     *
+     * @tparam T Type of the payload.
+     */
+    template <typename T>
+    class Pooled
+    {
+    public:
+        Pooled() = default;
+
+        ~Pooled()
+        {
+            Reset();
+        }
+
+        Pooled(const Pooled &other) noexcept :
+            _node(other._node)
+        {
+            if (_node) {
+                ++_node->References;
+            }
+        }
+
+        Pooled(Pooled &&other) noexcept :
+            _node(std::exchange(other._node, nullptr))
+        {}
+
+        Pooled &operator=(const Pooled &other) noexcept
+        {
+            Pooled copy{other};
+
+            std::swap(_node, copy._node);
+            return *this;
+        }
+
+        Pooled &operator=(Pooled &&other) noexcept
+        {
+            if (this != &other) {
+                Reset();
+                _node = std::exchange(other._node, nullptr);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Drops the reference, the payload is recycled if it was the last one.
+         *
+         */
+        void Reset() noexcept
+        {
+            if (_node && --_node->References == 0) {
+                _node->Pool->Recycle(_node);
+            }
+            _node = nullptr;
+        }
+
+        T *Get() const noexcept
+        {
+            return _node ? _node->Value : nullptr;
+        }
+
+        T &operator*() const noexcept
+        {
+            return *_node->Value;
+        }
+
+        T *operator->() const noexcept
+        {
+            return _node->Value;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return _node != nullptr;
+        }
+
+        /**
+         * @brief Gets the number of references to the payload.
+         *
+         * @return The reference count, 0 if empty.
+         */
+        std::size_t References() const noexcept
+        {
+            return _node ? _node->References : 0;
+        }
+
+    private:
+        friend class PayloadPool<T>;
+
+        explicit Pooled(details::PayloadNode<T> *node) noexcept :
+            _node(node)
+        {}
+
+    private:
+        details::PayloadNode<T> *_node{nullptr};
+    };
+
+    /**
+     * @brief Free list of payloads of a type, for subjects too large to be copied around.
+     *
+     * Payloads are allocated by blocks of fixed-size slots, a single size class per payload type,
+     * and recycled when their last `Pooled` reference is dropped: once the pool reached
+     * the peak number of payloads alive at once, making payloads does not allocate anymore.
+     * The pool must outlive the references to its payloads, and is not thread-safe.
+     *
+     * Example:
+     * @code
+     * struct ChunkEventArgs
+     * {
+     *     int X;
+     *     int Y;
+     *     indie::event::Pooled<ChunkData> Data;
+     * };
+     *
+     * indie::event::PayloadPool<ChunkData> chunks;
+     * auto data = chunks.Make();
+     * LoadChunk(*data);
+     * em.Enqueue<ChunkEventArgs>(x, y, std::move(data));
+     * @endcode
+     *
+     * @tparam T Type of the payload.
+     */
+    template <typename T>
+    class PayloadPool
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param block Number of payloads allocated at once when the free list is empty.
+         */
+        explicit PayloadPool(std::size_t block = 64) :
+            _block(block ? block : 1)
+        {}
+
+        ~PayloadPool() = default;
+
+        PayloadPool(const PayloadPool &other) = delete;
+        PayloadPool(PayloadPool &&other) = delete;
+        PayloadPool &operator=(const PayloadPool &other) = delete;
+        PayloadPool &operator=(PayloadPool &&other) = delete;
+
+        /**
+         * @brief Constructs a payload in a free slot.
+         *
+         * @tparam Args Types of the arguments.
+         * @param args Arguments of the payload constructor.
+         * @return The only reference to the payload.
+         */
+        template <typename ...Args>
+        Pooled<T> Make(Args &&...args)
+        {
+            if (!_free) {
+                Grow(_block);
+            }
+
+            auto node = _free;
+
+            node->Value = new (node->Storage) T{std::forward<Args>(args)...};
+            _free = node->Next;
+            --_available;
+            node->References = 1;
+            return Pooled<T>{node};
+        }
+
+        /**
+         * @brief Makes sure a number of payloads can be made without allocating.
+         *
+         * @param count Number of free payloads.
+         */
+        void Reserve(std::size_t count)
+        {
+            if (count > _available) {
+                Grow(count - _available);
+            }
+        }
+
+        /**
+         * @brief Gets the number of payload slots allocated.
+         *
+         * @return The number of slots, alive or free.
+         */
+        std::size_t Capacity() const noexcept
+        {
+            return _capacity;
+        }
+
+        /**
+         * @brief Gets the number of free payload slots.
+         *
+         * @return The number of slots ready to be reused.
+         */
+        std::size_t Available() const noexcept
+        {
+            return _available;
+        }
+
+    private:
+        using Node = details::PayloadNode<T>;
+
+        friend class Pooled<T>;
+
+        void Grow(std::size_t count)
+        {
+            auto block = std::make_unique<Node[]>(count);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                block[i].Pool = this;
+                block[i].Next = i + 1 < count ? &block[i + 1] : _free;
+            }
+            _free = &block[0];
+            _blocks.push_back(std::move(block));
+            _capacity += count;
+            _available += count;
+        }
+
+        void Recycle(Node *node) noexcept
+        {
+            node->Value->~T();
+            node->Next = _free;
+            _free = node;
+            ++_available;
+        }
+
+    private:
+        std::size_t _block;
+        std::vector<std::unique_ptr<Node[]>> _blocks;
+        Node *_free{nullptr};
+        std::size_t _capacity{0};
+        std::size_t _available{0};
+    };
+}
\ No newline at end of file
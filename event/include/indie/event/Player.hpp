@@ -0,0 +1,196 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "EventManager.hpp"
+#include "Recorder.hpp"
+
+namespace indie::event
+{
+    /**
+     * @brief Replays a recording made by `Recorder` into an event manager.
+     *
+     * Subjects are re-injected in recording order, notified if they were notified
+     * and queued if they were dispatched, so the next `Dispatch` delivers them.
+     * Subjects of types not bound with `Bind` are skipped.
+     *
+     * Example:
+     * @code
+     * indie::event::Player player{"session.ievr"};
+     * player.Bind<Walk>(1);
+     * // Original timing, one tick per frame
+     * while (!player.Done()) {
+     *     player.Play(em, frame++);
+     *     em.Dispatch();
+     * }
+     * // Or as fast as possible
+     * player.PlayAll(em);
+     * @endcode
+     */
+    class Player
+    {
+    public:
+        /**
+         * @brief Constructor, loads the whole recording.
+         *
+         * Throws `std::runtime_error` if the file cannot be read or is not a recording.
+         *
+         * @param path Path of the recording.
+         */
+        explicit Player(const std::string &path)
+        {
+            std::ifstream file(path, std::ios::binary);
+
+            if (!file) {
+                throw std::runtime_error("Cannot open recording: " + path);
+            }
+            _data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+            std::uint32_t version{0};
+            constexpr auto header = sizeof(details::RecordMagic) + sizeof(version);
+
+            if (_data.size() < header || std::memcmp(_data.data(), details::RecordMagic, sizeof(details::RecordMagic)) != 0) {
+                throw std::runtime_error("Not a recording: " + path);
+            }
+            std::memcpy(&version, _data.data() + sizeof(details::RecordMagic), sizeof(version));
+            if (version != details::RecordVersion) {
+                throw std::runtime_error("Unsupported recording version: " + path);
+            }
+            _cursor = header;
+        }
+
+        ~Player() = default;
+
+        Player(const Player &other) = delete;
+        Player &operator=(const Player &other) = delete;
+
+        /**
+         * @brief Replays subjects recorded under an identifier as a type.
+         *
+         * @tparam Subject Type of the subject, the one recorded with this identifier, default constructible.
+         * @param id Identifier of the subject type in the recording.
+         */
+        template <typename Subject>
+        void Bind(std::uint16_t id)
+        {
+            static_assert(std::is_trivially_copyable_v<Subject> && std::is_default_constructible_v<Subject>,
+                          "Only trivially copyable and default constructible subjects can be replayed");
+
+            if (id >= _inject.size()) {
+                _inject.resize(id + 1, nullptr);
+                _sizes.resize(id + 1, 0);
+            }
+            _sizes[id] = sizeof(Subject);
+            _inject[id] = [](EventManager &em, const char *bytes, RecordKind kind) {
+                Subject args;
+
+                std::memcpy(&args, bytes, sizeof(Subject));
+                if (kind == RecordKind::Dispatched) {
+                    em.Enqueue<Subject>(args);
+                }
+                else {
+                    em.Notify<Subject>(args);
+                }
+            };
+        }
+
+        /**
+         * @brief Replays the subjects recorded up to a tick.
+         *
+         * @param em The event manager receiving the subjects.
+         * @param tick Last tick to replay.
+         * @return The number of replayed subjects.
+         */
+        std::size_t Play(EventManager &em, std::uint64_t tick)
+        {
+            std::size_t count = 0;
+            details::RecordHeader header;
+
+            while (Peek(header) && header.Tick <= tick) {
+                auto bytes = _data.data() + _cursor + sizeof(header);
+
+                _cursor += sizeof(header) + header.Size;
+                if (header.Type < _inject.size() && _inject[header.Type] && _sizes[header.Type] == header.Size) {
+                    _inject[header.Type](em, bytes, header.Kind);
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Replays every remaining subject, as fast as possible.
+         *
+         * @param em The event manager receiving the subjects.
+         * @return The number of replayed subjects.
+         */
+        std::size_t PlayAll(EventManager &em)
+        {
+            return Play(em, UINT64_MAX);
+        }
+
+        /**
+         * @brief Gets the tick of the next subject to replay.
+         *
+         * @return The next tick, `UINT64_MAX` once done.
+         */
+        std::uint64_t NextTick() const noexcept
+        {
+            details::RecordHeader header;
+
+            return Peek(header) ? header.Tick : UINT64_MAX;
+        }
+
+        /**
+         * @brief Tells if every subject has been replayed.
+         *
+         * @return True if the recording is over.
+         */
+        bool Done() const noexcept
+        {
+            details::RecordHeader header;
+
+            return !Peek(header);
+        }
+
+        /**
+         * @brief Restarts the replay from the first subject.
+         *
+         */
+        void Rewind() noexcept
+        {
+            _cursor = sizeof(details::RecordMagic) + sizeof(details::RecordVersion);
+        }
+
+    private:
+        /**
+         * @brief Reads the header of the next subject, a truncated record ends the recording.
+         *
+         * @param header Receives the header.
+         * @return False if there is no complete record left.
+         */
+        bool Peek(details::RecordHeader &header) const noexcept
+        {
+            if (_data.size() - _cursor < sizeof(header)) {
+                return false;
+            }
+            std::memcpy(&header, _data.data() + _cursor, sizeof(header));
+            return _data.size() - _cursor - sizeof(header) >= header.Size;
+        }
+
+    private:
+        std::vector<char> _data;
+        std::size_t _cursor{0};
+        /*! Injection of each bound type, indexed by identifier */
+        std::vector<void (*)(EventManager &, const char *, RecordKind)> _inject;
+        std::vector<std::size_t> _sizes;
+    };
+}
\ No newline at end of file
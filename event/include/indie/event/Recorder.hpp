@@ -0,0 +1,242 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <atomic>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Span.hpp"
+
+namespace indie::event
+{
+    /**
+     * @brief How a recorded subject reached the observers.
+     *
+     */
+    enum class RecordKind : std::uint8_t
+    {
+        /*! Passed to `Notify` */
+        Notified,
+        /*! Delivered by `Dispatch` */
+        Dispatched
+    };
+
+    namespace details
+    {
+        /*! First bytes of a recording */
+        static constexpr char RecordMagic[4] = {'I', 'E', 'V', 'R'};
+        static constexpr std::uint32_t RecordVersion = 1;
+
+        /**
+         * @brief Header of a recorded subject, followed by its raw bytes.
+         *
+         */
+        struct RecordHeader
+        {
+            /*! Tick of the recorder when the subject was delivered */
+            std::uint64_t Tick;
+            /*! Identifier given to the subject type when recording */
+            std::uint16_t Type;
+            RecordKind Kind;
+            std::uint8_t Padding;
+            /*! Size of the subject, in bytes */
+            std::uint32_t Size;
+        };
+        static_assert(sizeof(RecordHeader) == 16, "Recording format must not depend on the platform");
+    }
+
+    /**
+     * @brief Writes delivered subjects to an append-only binary file, to replay a session with `Player`.
+     *
+     * Only subject types given an identifier through `Record` are written,
+     * each one as a header (tick, type identifier, kind, size) followed by its raw bytes.
+     * Writes go through an in-memory buffer, flushed to the file when full and on destruction.
+     *
+     * Example:
+     * @code
+     * indie::event::Recorder recorder{"session.ievr"};
+     * recorder.Record<Walk>(1);
+     * em.Record(&recorder);
+     * while (running) {
+     *     recorder.SetTick(frame++);
+     *     ...
+     * }
+     * @endcode
+     */
+    class Recorder
+    {
+    public:
+        /*! Buffer size flushed to the file at once */
+        static constexpr std::size_t BufferSize = 64 * 1024;
+
+    public:
+        /**
+         * @brief Constructor, creates or truncates the file.
+         *
+         * Throws `std::runtime_error` if the file cannot be opened.
+         *
+         * @param path Path of the recording.
+         */
+        explicit Recorder(const std::string &path) :
+            _file(path, std::ios::binary | std::ios::trunc), _buffer(std::make_unique<char[]>(BufferSize))
+        {
+            if (!_file) {
+                throw std::runtime_error("Cannot open recording: " + path);
+            }
+            Append(details::RecordMagic, sizeof(details::RecordMagic));
+            Append(&details::RecordVersion, sizeof(details::RecordVersion));
+        }
+
+        ~Recorder()
+        {
+            Flush();
+        }
+
+        Recorder(const Recorder &other) = delete;
+        Recorder &operator=(const Recorder &other) = delete;
+
+        /**
+         * @brief Records subjects of a type under a stable identifier.
+         *
+         * The identifier is written in place of the type, the player must bind the same one.
+         *
+         * @tparam Subject Type of the subject, trivially copyable.
+         * @param id Identifier of the subject type in the recording.
+         */
+        template <typename Subject>
+        void Record(std::uint16_t id)
+        {
+            static_assert(std::is_trivially_copyable_v<Subject>, "Only trivially copyable subjects can be recorded");
+
+            auto index = IndexOf<Subject>();
+
+            if (index >= _types.size()) {
+                _types.resize(index + 1, Unrecorded);
+            }
+            _types[index] = id;
+        }
+
+        /**
+         * @brief Sets the tick written with the next subjects, usually the frame number.
+         *
+         * @param tick The current tick.
+         */
+        void SetTick(std::uint64_t tick) noexcept
+        {
+            _tick = tick;
+        }
+
+        std::uint64_t Tick() const noexcept
+        {
+            return _tick;
+        }
+
+        /**
+         * @brief Writes a subject if its type is recorded.
+         *
+         * @tparam Subject Type of the subject.
+         * @param args The subject.
+         * @param kind How the subject is delivered.
+         */
+        template <typename Subject>
+        void Write(const Subject &args, RecordKind kind)
+        {
+            Write(Span<const Subject>{&args, 1}, kind);
+        }
+
+        /**
+         * @brief Writes a batch of subjects if their type is recorded.
+         *
+         * @tparam Subject Type of the subjects.
+         * @param events The subjects.
+         * @param kind How the subjects are delivered.
+         */
+        template <typename Subject>
+        void Write(Span<Subject> events, RecordKind kind)
+        {
+            using Type = std::remove_const_t<Subject>;
+
+            auto index = IndexOf<Type>();
+
+            if (index >= _types.size() || _types[index] == Unrecorded) {
+                return;
+            }
+            if constexpr (std::is_trivially_copyable_v<Type>) {
+                details::RecordHeader header{_tick, _types[index], kind, 0, static_cast<std::uint32_t>(sizeof(Type))};
+
+                for (auto &args : events) {
+                    Append(&header, sizeof(header));
+                    Append(&args, sizeof(Type));
+                }
+                _written += events.Size();
+            }
+        }
+
+        /**
+         * @brief Writes the buffered subjects to the file.
+         *
+         */
+        void Flush()
+        {
+            _file.write(_buffer.get(), static_cast<std::streamsize>(_used));
+            _file.flush();
+            _used = 0;
+        }
+
+        /**
+         * @brief Gets the number of subjects written since the construction.
+         *
+         * @return The number of recorded subjects.
+         */
+        std::size_t Written() const noexcept
+        {
+            return _written;
+        }
+
+    private:
+        static constexpr std::uint16_t Unrecorded = 0xFFFF;
+
+        template <typename Subject>
+        static std::size_t IndexOf() noexcept
+        {
+            static std::size_t index{GenerateIndex()};
+
+            return index;
+        }
+
+        static std::size_t GenerateIndex() noexcept
+        {
+            static std::atomic<std::size_t> cur{0};
+
+            return cur++;
+        }
+
+        void Append(const void *data, std::size_t size)
+        {
+            if (_used + size > BufferSize) {
+                Flush();
+                if (size > BufferSize) {
+                    _file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+                    return;
+                }
+            }
+            std::memcpy(_buffer.get() + _used, data, size);
+            _used += size;
+        }
+
+    private:
+        std::ofstream _file;
+        std::unique_ptr<char[]> _buffer;
+        std::size_t _used{0};
+        /*! Identifier of each recorded type in the file, indexed by type index */
+        std::vector<std::uint16_t> _types;
+        std::uint64_t _tick{0};
+        std::size_t _written{0};
+    };
+}
\ No newline at end of file
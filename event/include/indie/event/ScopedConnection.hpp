@@ -0,0 +1,96 @@
+#pragma once
+
+#include <utility>
+
+#include "EventManager.hpp"
+
+namespace indie::event
+{
+    /**
+     * @brief Owns a connection and disconnects it on destruction.
+     *
+     * Held by the observer, it unregisters the observer when it dies,
+     * so the event manager never calls a destroyed object.
+     * The event manager must outlive the scoped connection.
+     *
+     * Example:
+     * @code
+     * struct Player
+     * {
+     *     Player(indie::event::EventManager &em) :
+     *         connection(em, em.Register<Walk, Hit>(this))
+     *     {}
+     *
+     *     indie::event::ScopedConnection connection;
+     * };
+     * @endcode
+     */
+    class ScopedConnection
+    {
+    public:
+        ScopedConnection() = default;
+
+        ScopedConnection(EventManager &em, Connection connection) noexcept :
+            _em(&em), _connection(connection)
+        {}
+
+        ~ScopedConnection()
+        {
+            Disconnect();
+        }
+
+        ScopedConnection(const ScopedConnection &other) = delete;
+        ScopedConnection &operator=(const ScopedConnection &other) = delete;
+
+        ScopedConnection(ScopedConnection &&other) noexcept :
+            _em(std::exchange(other._em, nullptr)), _connection(other._connection)
+        {}
+
+        ScopedConnection &operator=(ScopedConnection &&other) noexcept
+        {
+            if (this != &other) {
+                Disconnect();
+                _em = std::exchange(other._em, nullptr);
+                _connection = other._connection;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Disconnects the connection now, does nothing if it is not owned anymore.
+         *
+         */
+        void Disconnect() noexcept
+        {
+            if (_em) {
+                _em->Disconnect(_connection);
+                _em = nullptr;
+            }
+        }
+
+        /**
+         * @brief Gives up the ownership of the connection, it will not be disconnected on destruction.
+         *
+         * @return The connection.
+         */
+        Connection Release() noexcept
+        {
+            _em = nullptr;
+            return _connection;
+        }
+
+        /**
+         * @brief Tells if the owned connection still has a registered observer.
+         *
+         * @return True if connected.
+         */
+        bool Connected() const noexcept
+        {
+            return _em && _em->Connected(_connection);
+        }
+
+    private:
+        EventManager *_em{nullptr};
+        Connection _connection;
+    };
+}
\ No newline at end of file
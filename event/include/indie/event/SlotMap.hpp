@@ -0,0 +1,195 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace indie::event::details
+{
+    /**
+     * @brief Stable reference to a value of a `SlotMap`.
+     *
+     * The generation tells apart the successive values of a slot,
+     * a handle to a removed value never matches the values stored after it.
+     */
+    struct SlotHandle
+    {
+        static constexpr std::uint32_t Invalid = UINT32_MAX;
+
+        std::uint32_t Index{Invalid};
+        std::uint32_t Generation{0};
+    };
+
+    /**
+     * @brief Values stored contiguously, referenced by stable handles.
+     *
+     * Each value owns a slot giving its position, so a handle is resolved
+     * and a value removed in constant time: the last value takes the place of the removed one.
+     * Freed slots are reused by the next insertions, their generation is bumped on removal.
+     *
+     * @tparam T Type of the values.
+     */
+    template <typename T>
+    class SlotMap
+    {
+    public:
+        /**
+         * @brief Inserts a value at the end.
+         *
+         * @tparam Args Types of the arguments.
+         * @param args Arguments of the value constructor.
+         * @return The handle of the value.
+         */
+        template <typename ...Args>
+        SlotHandle Emplace(Args &&...args)
+        {
+            std::uint32_t index = _free;
+
+            if (index == SlotHandle::Invalid) {
+                index = static_cast<std::uint32_t>(_slots.size());
+                _slots.push_back(Slot{});
+            }
+            else {
+                _free = _slots[index].Position;
+            }
+            _values.push_back(T{std::forward<Args>(args)...});
+            _owners.push_back(index);
+            _slots[index].Position = static_cast<std::uint32_t>(_values.size() - 1);
+            return SlotHandle{index, _slots[index].Generation};
+        }
+
+        /**
+         * @brief Removes a value.
+         *
+         * @param handle The handle of the value.
+         * @return False if the handle does not refer to a value anymore.
+         */
+        bool Erase(SlotHandle handle) noexcept
+        {
+            if (!Contains(handle)) {
+                return false;
+            }
+            EraseAt(_slots[handle.Index].Position);
+            return true;
+        }
+
+        /**
+         * @brief Removes the value at a position, the last value takes its place.
+         *
+         * @param position Position of the value, less than `Size()`.
+         */
+        void EraseAt(std::size_t position) noexcept
+        {
+            auto index = _owners[position];
+
+            if (position + 1 != _values.size()) {
+                _values[position] = std::move(_values.back());
+                _owners[position] = _owners.back();
+                _slots[_owners[position]].Position = static_cast<std::uint32_t>(position);
+            }
+            _values.pop_back();
+            _owners.pop_back();
+            Free(index);
+        }
+
+        /**
+         * @brief Removes every value, their handles are invalidated.
+         *
+         */
+        void Clear() noexcept
+        {
+            for (auto index : _owners) {
+                Free(index);
+            }
+            _values.clear();
+            _owners.clear();
+        }
+
+        bool Contains(SlotHandle handle) const noexcept
+        {
+            return handle.Index < _slots.size() && _slots[handle.Index].Generation == handle.Generation;
+        }
+
+        /**
+         * @brief Resolves a handle.
+         *
+         * @param handle The handle of the value.
+         * @return The value, null if the handle does not refer to a value anymore.
+         */
+        T *Get(SlotHandle handle) noexcept
+        {
+            return Contains(handle) ? &_values[_slots[handle.Index].Position] : nullptr;
+        }
+
+        /*! @copydoc SlotMap::Get(SlotHandle) */
+        const T *Get(SlotHandle handle) const noexcept
+        {
+            return Contains(handle) ? &_values[_slots[handle.Index].Position] : nullptr;
+        }
+
+        /**
+         * @brief Gets the handle of the value at a position.
+         *
+         * @param position Position of the value, less than `Size()`.
+         * @return The handle of the value.
+         */
+        SlotHandle HandleAt(std::size_t position) const noexcept
+        {
+            auto index = _owners[position];
+
+            return SlotHandle{index, _slots[index].Generation};
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return _values.size();
+        }
+
+        T &operator[](std::size_t position) noexcept
+        {
+            return _values[position];
+        }
+
+        const T &operator[](std::size_t position) const noexcept
+        {
+            return _values[position];
+        }
+
+        typename std::vector<T>::const_iterator begin() const noexcept
+        {
+            return _values.begin();
+        }
+
+        typename std::vector<T>::const_iterator end() const noexcept
+        {
+            return _values.end();
+        }
+
+    private:
+        /**
+         * @brief Position of the value owning the slot, or next free slot.
+         *
+         */
+        struct Slot
+        {
+            std::uint32_t Position{0};
+            std::uint32_t Generation{0};
+        };
+
+        void Free(std::uint32_t index) noexcept
+        {
+            ++_slots[index].Generation;
+            _slots[index].Position = _free;
+            _free = index;
+        }
+
+    private:
+        std::vector<T> _values;
+        /*! Slot of each value */
+        std::vector<std::uint32_t> _owners;
+        std::vector<Slot> _slots;
+        /*! First free slot, its position is the next free one */
+        std::uint32_t _free{SlotHandle::Invalid};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+
+namespace indie::event
+{
+    /**
+     * @brief Non-owning view over contiguous events.
+     *
+     * @tparam T Type of the events.
+     */
+    template <typename T>
+    class Span
+    {
+    public:
+        Span() = default;
+
+        Span(T *data, std::size_t size) noexcept :
+            _data(data), _size(size)
+        {}
+
+        T *begin() const noexcept
+        {
+            return _data;
+        }
+
+        T *end() const noexcept
+        {
+            return _data + _size;
+        }
+
+        T &operator[](std::size_t index) const noexcept
+        {
+            return _data[index];
+        }
+
+        T *Data() const noexcept
+        {
+            return _data;
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return _size;
+        }
+
+        bool Empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+    private:
+        T *_data{nullptr};
+        std::size_t _size{0};
+    };
+}
\ No newline at end of file
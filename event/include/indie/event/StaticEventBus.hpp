@@ -0,0 +1,308 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <indie/meta/TypeList.hpp>
+#include <indie/meta/Tuple.hpp>
+
+#include "Observer.hpp"
+
+namespace indie::event
+{
+    namespace details
+    {
+        /**
+         * @brief Tells if a handler is called with `Arg`, through `OnReceive` or its call operator.
+         *
+         */
+        template <typename T, typename Arg>
+        struct CanHandle : std::bool_constant<CanReceive<T, Arg>::value || std::is_invocable_v<T &, Arg>>
+        {};
+
+        template <typename Handler, typename Arg>
+        inline void Handle(Handler &handler, Arg &&args)
+        {
+            if constexpr (CanReceive<Handler, Arg>::value) {
+                handler.OnReceive(std::forward<Arg>(args));
+            }
+            else {
+                handler(std::forward<Arg>(args));
+            }
+        }
+    }
+
+    template <typename SubjectList, typename ...Handlers>
+    class StaticEventBus;
+
+    /**
+     * @brief Event manager for a set of subjects known at compile time.
+     *
+     * Each subject has its own observer array, held in a tuple and found at compile time,
+     * there is no type identifier lookup nor type erasure on the way to the observers.
+     *
+     * Handlers are part of the bus type and held by value. They receive subjects
+     * through `OnReceive` or their call operator, before the registered observers,
+     * and these calls are direct so the compiler can inline them.
+     * Handlers accepting a `Span<Subject>` receive queued subjects by batch, one at a time otherwise.
+     *
+     * Example:
+     * @code
+     * using Bus = indie::event::StaticEventBus<indie::meta::TypeList<Walk, Auth>, Movement, Sessions>;
+     * Bus bus;
+     * bus.Register<Auth>(logger);
+     * bus.Notify(walk);
+     * @endcode
+     *
+     * @tparam Subjects Types of the subjects.
+     * @tparam Handlers Types of the handlers, all different.
+     */
+    template <typename ...Subjects, typename ...Handlers>
+    class StaticEventBus<meta::TypeList<Subjects...>, Handlers...>
+    {
+    public:
+        /*! Types of the subjects */
+        using SubjectList = meta::TypeList<Subjects...>;
+
+        template <typename SubjectType>
+        using ObserverPoolType = ObserverArray<SubjectType>;
+
+    public:
+        StaticEventBus() = default;
+
+        /**
+         * @brief Constructor, copies or moves the handlers.
+         *
+         * @param handlers The handlers, in declaration order.
+         */
+        template <typename ...Args, typename = std::enable_if_t<sizeof...(Args) == sizeof...(Handlers) && sizeof...(Args) != 0>>
+        explicit StaticEventBus(Args &&...handlers) :
+            _handlers(std::forward<Args>(handlers)...)
+        {}
+
+        ~StaticEventBus() = default;
+
+        StaticEventBus(StaticEventBus &other) = delete;
+        StaticEventBus(StaticEventBus &&other) = delete;
+        StaticEventBus &operator=(StaticEventBus &other) = delete;
+        StaticEventBus &operator=(StaticEventBus &&other) = delete;
+
+    public:
+        /**
+         * @brief Tells if a subject is handled by the bus.
+         *
+         * @tparam Subject Type of the subject.
+         * @return true If the bus handles the subject.
+         */
+        template <typename Subject>
+        static constexpr bool Handles() noexcept
+        {
+            return meta::TypeListHas<Subject, SubjectList>::value;
+        }
+
+        /**
+         * @brief Gets a handler.
+         *
+         * @tparam Handler Type of the handler.
+         * @return The handler.
+         */
+        template <typename Handler>
+        Handler &Get() noexcept
+        {
+            return _handlers.template Get<Handler>();
+        }
+
+        /**
+         * @brief Registers an observer to given subjects.
+         *
+         * @tparam Subject Type of the subject.
+         * @tparam Ss Type of the next subjects if exist.
+         * @tparam ObserverType Type of the observer.
+         * @param observer The observer object pointer/reference.
+         */
+        template <typename Subject, typename ...Ss, typename ObserverType>
+        void Register(ObserverType *observer)
+        {
+            Pool<Subject>().Register(observer);
+            (Pool<Ss>().Register(observer), ...);
+        }
+
+        /*! @copydoc StaticEventBus::Register(ObserverType*) */
+        template <typename Subject, typename ...Ss, typename ObserverType>
+        void Register(ObserverType &observer)
+        {
+            Register<Subject, Ss...>(&observer);
+        }
+
+        /**
+         * @brief Unregisters an observer from given subjects, or from every subject without template argument.
+         *
+         * @tparam Ss Type of the subjects.
+         * @tparam ObserverType Type of the observer.
+         * @param observer The observer object pointer/reference.
+         */
+        template <typename ...Ss, typename ObserverType>
+        void Unregister(ObserverType *observer) noexcept
+        {
+            if constexpr (sizeof...(Ss) == 0) {
+                (Pool<Subjects>().Unregister(observer), ...);
+            }
+            else {
+                (Pool<Ss>().Unregister(observer), ...);
+            }
+        }
+
+        /*! @copydoc StaticEventBus::Unregister(ObserverType*) */
+        template <typename ...Ss, typename ObserverType>
+        void Unregister(ObserverType &observer) noexcept
+        {
+            Unregister<Ss...>(&observer);
+        }
+
+        /**
+         * @brief Tells if an observer is watching for given subjects, or for any subject without template argument.
+         *
+         * @tparam Ss Type of the subjects.
+         * @tparam ObserverType Type of the observer.
+         * @param observer The observer object pointer/reference.
+         * @return True if the observer is watching for given subjects, false otherwise.
+         */
+        template <typename ...Ss, typename ObserverType>
+        bool Has(ObserverType *observer) const noexcept
+        {
+            if constexpr (sizeof...(Ss) == 0) {
+                return (Pool<Subjects>().Has(observer) || ...);
+            }
+            else {
+                return (Pool<Ss>().Has(observer) && ...);
+            }
+        }
+
+        /*! @copydoc StaticEventBus::Has(ObserverType*) */
+        template <typename ...Ss, typename ObserverType>
+        bool Has(ObserverType &observer) const noexcept
+        {
+            return Has<Ss...>(&observer);
+        }
+
+        /**
+         * @brief Notifies the handlers then the observers of a subject.
+         *
+         * @tparam Subject Type of the subject.
+         * @param args Argument passed to handlers and observers.
+         */
+        template <typename Subject>
+        void Notify(Subject &args)
+        {
+            (NotifyHandler<Handlers>(args), ...);
+            Pool<Subject>().Notify(args);
+        }
+
+        /**
+         * @brief Queues a subject, delivered by the next `Dispatch`.
+         *
+         * @tparam Subject Type of the subject.
+         * @tparam Args Types of the arguments.
+         * @param args Arguments of the subject constructor, usually a subject to copy.
+         */
+        template <typename Subject, typename ...Args>
+        void Enqueue(Args &&...args)
+        {
+            Pool<Subject>().Enqueue(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Delivers queued subjects of given types, or of every type without template argument.
+         *
+         * Subjects are delivered in the order of the subject list, to the handlers then to the observers.
+         *
+         * @tparam Ss Types of the subjects.
+         */
+        template <typename ...Ss>
+        void Dispatch()
+        {
+            if constexpr (sizeof...(Ss) == 0) {
+                (DispatchSubject<Subjects>(), ...);
+            }
+            else {
+                (DispatchSubject<Ss>(), ...);
+            }
+        }
+
+        /**
+         * @brief Gets the number of subjects waiting for the next dispatch.
+         *
+         * @tparam Subject Type of the subject.
+         * @return The number of queued subjects.
+         */
+        template <typename Subject>
+        std::size_t Queued() const noexcept
+        {
+            return Pool<Subject>().Queued();
+        }
+
+        /**
+         * @brief Removes observers from given subjects, handlers stay.
+         *
+         * @tparam Subject Type of the subject.
+         * @tparam Ss Type of the next subjects, if exist.
+         */
+        template <typename Subject, typename ...Ss>
+        void Reset() noexcept
+        {
+            Pool<Subject>().Clear();
+            (Pool<Ss>().Clear(), ...);
+        }
+
+    private:
+        template <typename Subject>
+        ObserverPoolType<Subject> &Pool() noexcept
+        {
+            return const_cast<ObserverPoolType<Subject> &>(std::as_const(*this).template Pool<Subject>());
+        }
+
+        template <typename Subject>
+        const ObserverPoolType<Subject> &Pool() const noexcept
+        {
+            static_assert(Handles<Subject>(), "Subject is not handled by this bus");
+            return _arrays.template Get<ObserverPoolType<Subject>>();
+        }
+
+        template <typename Handler, typename Subject>
+        void NotifyHandler(Subject &args)
+        {
+            if constexpr (details::CanHandle<Handler, Subject &>::value) {
+                details::Handle(_handlers.template Get<Handler>(), args);
+            }
+            else if constexpr (details::CanHandle<Handler, Span<Subject>>::value) {
+                details::Handle(_handlers.template Get<Handler>(), Span<Subject>{&args, 1});
+            }
+        }
+
+        template <typename Subject>
+        void DispatchSubject()
+        {
+            Pool<Subject>().Dispatch([this](Span<Subject> events) {
+                (DispatchHandler<Handlers>(events), ...);
+            });
+        }
+
+        template <typename Handler, typename Subject>
+        void DispatchHandler(Span<Subject> events)
+        {
+            if constexpr (details::CanHandle<Handler, Span<Subject>>::value) {
+                details::Handle(_handlers.template Get<Handler>(), events);
+            }
+            else if constexpr (details::CanHandle<Handler, Subject &>::value) {
+                for (auto &args : events) {
+                    details::Handle(_handlers.template Get<Handler>(), args);
+                }
+            }
+        }
+
+    private:
+        meta::Tuple<Handlers...> _handlers;
+        meta::Tuple<ObserverPoolType<Subjects>...> _arrays;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <thread>
+
+#include <indie/event/Channel.hpp>
+
+struct MoveEventArgs
+{
+    int Producer;
+    int Sequence;
+};
+
+struct LoginEventArgs
+{
+    int Id;
+};
+
+struct Simulation
+{
+    void OnReceive(indie::event::Span<MoveEventArgs> events)
+    {
+        for (auto &args : events) {
+            // Subjects of a producer keep their order
+            ASSERT_EQ(args.Sequence, Last[args.Producer] + 1);
+            Last[args.Producer] = args.Sequence;
+        }
+        Moves += events.Size();
+    }
+
+    void OnReceive(LoginEventArgs &)
+    {
+        ++Logins;
+    }
+
+    std::vector<int> Last;
+    std::size_t Moves{0};
+    std::size_t Logins{0};
+};
+
+TEST(Channel, ManyProducers)
+{
+    static constexpr int Producers = 4;
+    static constexpr int Count = 10000;
+
+    indie::event::EventManager em;
+    indie::event::Channel<MoveEventArgs, LoginEventArgs> channel{64, indie::event::Overflow::Wait};
+    Simulation simulation;
+    std::vector<std::thread> threads;
+
+    simulation.Last.assign(Producers, -1);
+    em.Register<MoveEventArgs, LoginEventArgs>(simulation);
+    for (int producer = 0; producer < Producers; ++producer) {
+        threads.emplace_back([&channel, producer] {
+            channel.Send<LoginEventArgs>(producer);
+            for (int i = 0; i < Count; ++i) {
+                channel.Send<MoveEventArgs>(producer, i);
+            }
+        });
+    }
+
+    // The game thread drains while producers are blocked on full queues
+    while (simulation.Moves < Producers * Count) {
+        channel.Drain(em);
+        em.Dispatch();
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(simulation.Logins, static_cast<std::size_t>(Producers));
+    ASSERT_EQ(channel.Dropped<MoveEventArgs>(), 0);
+    for (auto last : simulation.Last) {
+        ASSERT_EQ(last, Count - 1);
+    }
+}
+
+TEST(Channel, Overflow)
+{
+    indie::event::EventManager em;
+    indie::event::Channel<MoveEventArgs> channel{4};
+    Simulation simulation;
+
+    simulation.Last.assign(1, -1);
+    em.Register<MoveEventArgs>(simulation);
+
+    for (int i = 0; i < 6; ++i) {
+        channel.Send<MoveEventArgs>(0, i);
+    }
+    ASSERT_EQ(channel.Dropped<MoveEventArgs>(), 2);
+
+    // Subjects stay in the channel until drained
+    em.Dispatch();
+    ASSERT_EQ(simulation.Moves, 0);
+    ASSERT_EQ(channel.Drain(em), 4);
+    ASSERT_EQ(em.Queued<MoveEventArgs>(), 4);
+    em.Dispatch();
+    ASSERT_EQ(simulation.Moves, 4);
+    ASSERT_EQ(simulation.Last[0], 3);
+
+    // Room is made by draining
+    ASSERT_TRUE(channel.Send<MoveEventArgs>(0, 4));
+    ASSERT_EQ(channel.Drain(em), 1);
+}
\ No newline at end of file
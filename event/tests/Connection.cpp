@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <indie/event/ScopedConnection.hpp>
+
+struct PingEventArgs
+{
+    int Value;
+};
+
+struct PongEventArgs
+{
+    int Value;
+};
+
+struct Paddle
+{
+    void OnReceive(PingEventArgs &)
+    {
+        ++Pings;
+    }
+
+    void OnReceive(PongEventArgs &)
+    {
+        ++Pongs;
+    }
+
+    int Pings{0};
+    int Pongs{0};
+};
+
+TEST(Connection, Disconnect)
+{
+    indie::event::EventManager em;
+    Paddle a, b, c;
+    PingEventArgs ping{0};
+    PongEventArgs pong{0};
+
+    auto ca = em.Register<PingEventArgs, PongEventArgs>(a);
+    auto cb = em.Register<PingEventArgs>(b);
+    auto cc = em.Register<PingEventArgs, PongEventArgs>(c);
+
+    ASSERT_TRUE(em.Connected(ca));
+    ASSERT_TRUE(em.Disconnect(ca));
+    ASSERT_FALSE(em.Connected(ca));
+    ASSERT_FALSE(em.Disconnect(ca));
+    ASSERT_FALSE(em.Has(a));
+
+    // The other connections still refer to their observers once the last ones moved
+    em.Notify(ping, pong);
+    ASSERT_EQ(a.Pings + a.Pongs, 0);
+    ASSERT_EQ(b.Pings, 1);
+    ASSERT_EQ(c.Pings + c.Pongs, 2);
+    ASSERT_TRUE(em.Disconnect(cc));
+    ASSERT_TRUE(em.Has<PingEventArgs>(b));
+    ASSERT_FALSE(em.Has(c));
+
+    // A stale connection never matches a later registration
+    auto again = em.Register<PingEventArgs>(a);
+    ASSERT_FALSE(em.Disconnect(ca));
+    ASSERT_TRUE(em.Has<PingEventArgs>(a));
+
+    // Unregistered by pointer, the connection is disconnected too
+    em.Unregister(b);
+    ASSERT_FALSE(em.Connected(cb));
+    ASSERT_FALSE(em.Disconnect(cb));
+    ASSERT_FALSE(em.Disconnect(indie::event::Connection{}));
+    ASSERT_TRUE(em.Disconnect(again));
+}
+
+/**
+ * @brief Dies while registered, without unregistering by hand.
+ *
+ */
+struct Ball
+{
+    explicit Ball(indie::event::EventManager &em) :
+        connection(em, em.Register<PingEventArgs, PongEventArgs>(this))
+    {}
+
+    void OnReceive(PingEventArgs &)
+    {
+        ++Hits;
+    }
+
+    void OnReceive(PongEventArgs &)
+    {
+        ++Hits;
+    }
+
+    int Hits{0};
+    indie::event::ScopedConnection connection;
+};
+
+TEST(Connection, Scoped)
+{
+    indie::event::EventManager em;
+    PingEventArgs ping{0};
+    auto ball = std::make_unique<Ball>(em);
+    auto other = std::make_unique<Ball>(em);
+
+    em.Notify(ping);
+    ASSERT_EQ(ball->Hits, 1);
+    ASSERT_TRUE(ball->connection.Connected());
+
+    // Destroyed objects are not called anymore
+    ball.reset();
+    em.Notify(ping);
+    ASSERT_EQ(other->Hits, 2);
+    ASSERT_FALSE(em.Has<PongEventArgs>(ball.get()));
+
+    // Moved connections are disconnected once
+    indie::event::ScopedConnection moved{std::move(other->connection)};
+    ASSERT_FALSE(other->connection.Connected());
+    ASSERT_TRUE(moved.Connected());
+    auto released = moved.Release();
+    ASSERT_TRUE(em.Connected(released));
+    ASSERT_TRUE(em.Disconnect(released));
+}
+
+/**
+ * @brief Disconnects itself and another observer when notified.
+ *
+ */
+struct Breaker
+{
+    void Receive()
+    {
+        ++Received;
+        if (Target) {
+            em->Disconnect(*Target);
+        }
+        if (Self) {
+            em->Disconnect(*Self);
+        }
+    }
+
+    void OnReceive(PingEventArgs &)
+    {
+        Receive();
+    }
+
+    void OnReceive(indie::event::Span<PongEventArgs> events)
+    {
+        for (std::size_t i = 0; i < events.Size(); ++i) {
+            Receive();
+        }
+    }
+
+    indie::event::EventManager *em;
+    indie::event::Connection *Self{nullptr};
+    indie::event::Connection *Target{nullptr};
+    int Received{0};
+};
+
+TEST(Connection, DisconnectDuringDelivery)
+{
+    indie::event::EventManager em;
+    std::vector<Breaker> breakers(4, Breaker{&em});
+    std::vector<indie::event::Connection> connections;
+    PingEventArgs ping{0};
+
+    for (auto &breaker : breakers) {
+        connections.push_back(em.Register<PingEventArgs, PongEventArgs>(breaker));
+    }
+    // The first removes itself and the last, which would take its place
+    breakers[0].Self = &connections[0];
+    breakers[0].Target = &connections[3];
+    em.Notify(ping);
+    ASSERT_EQ(breakers[0].Received, 1);
+    ASSERT_EQ(breakers[1].Received, 1);
+    ASSERT_EQ(breakers[2].Received, 1);
+    ASSERT_EQ(breakers[3].Received, 0);
+    ASSERT_FALSE(em.Connected(connections[3]));
+
+    // Same during a dispatch, whichever comes first removes the other, which gets nothing more
+    breakers[1].Target = &connections[2];
+    breakers[2].Target = &connections[1];
+    em.Enqueue<PongEventArgs>(1);
+    em.Enqueue<PongEventArgs>(2);
+    em.Dispatch();
+    ASSERT_EQ(breakers[1].Received + breakers[2].Received, 4);
+    ASSERT_NE(em.Connected(connections[1]), em.Connected(connections[2]));
+
+    auto &kept = em.Connected(connections[1]) ? breakers[1] : breakers[2];
+    em.Notify(ping);
+    ASSERT_EQ(kept.Received, 4);
+}
\ No newline at end of file
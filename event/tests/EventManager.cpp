@@ -1,6 +1,41 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+#include <cstdlib>
+#include <new>
+
 #include <indie/event/EventManager.hpp>
+#include <indie/event/Payload.hpp>
+
+/*! Number of heap allocations, to check dispatch does not allocate */
+static std::size_t allocations{0};
+
+void *operator new(std::size_t size)
+{
+    ++allocations;
+    if (auto ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+// GCC does not know free matches the replaced operator new
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
 
 struct HealEventArgs
 {
@@ -34,4 +69,460 @@ TEST(OneHandler, OneObserver)
     em.Unregister(p);
     em.Notify();
     ASSERT_EQ(p.Hp, 300);
+}
+
+struct DamageEventArgs
+{
+    int Value;
+};
+
+struct Monster
+{
+    void OnReceive(HealEventArgs &args)
+    {
+        Hp += args.Value;
+    }
+
+    void OnReceive(DamageEventArgs &args)
+    {
+        Hp -= args.Value;
+    }
+
+    int Hp{100};
+};
+
+TEST(ManyHandlers, ManyObservers)
+{
+    indie::event::EventManager em;
+    Player p;
+    Monster m1;
+    Monster m2;
+    HealEventArgs heal{10};
+    DamageEventArgs damage{30};
+
+    em.Register<HealEventArgs>(p);
+    em.Register<HealEventArgs, DamageEventArgs>(m1);
+    em.Register<DamageEventArgs>(&m2);
+    ASSERT_TRUE((em.Has<HealEventArgs, DamageEventArgs>(m1)));
+    ASSERT_FALSE((em.Has<HealEventArgs, DamageEventArgs>(m2)));
+    ASSERT_TRUE(em.Has(m2));
+
+    em.Notify(heal, damage);
+    ASSERT_EQ(p.Hp, 110);
+    ASSERT_EQ(m1.Hp, 80);
+    ASSERT_EQ(m2.Hp, 70);
+
+    // Only observers watching both subjects
+    em.Notify<DamageEventArgs, HealEventArgs>(damage);
+    ASSERT_EQ(m1.Hp, 50);
+    ASSERT_EQ(m2.Hp, 70);
+
+    // Default constructed subjects, no damage
+    em.Notify();
+    ASSERT_EQ(p.Hp, 210);
+    ASSERT_EQ(m1.Hp, 150);
+    ASSERT_EQ(m2.Hp, 70);
+
+    em.Unregister<HealEventArgs>(m1);
+    ASSERT_FALSE(em.Has<HealEventArgs>(m1));
+    ASSERT_TRUE(em.Has<DamageEventArgs>(m1));
+    em.Reset<DamageEventArgs>();
+    em.Notify(heal, damage);
+    ASSERT_EQ(p.Hp, 220);
+    ASSERT_EQ(m1.Hp, 150);
+    ASSERT_EQ(m2.Hp, 70);
+    ASSERT_FALSE(em.Has(m2));
+}
+
+struct Healer
+{
+    void OnReceive(indie::event::Span<HealEventArgs> events)
+    {
+        ++batches;
+        for (auto &args : events) {
+            total += args.Value;
+        }
+    }
+
+    int batches{0};
+    int total{0};
+};
+
+struct Echo
+{
+    void OnReceive(DamageEventArgs &args)
+    {
+        values.push_back(args.Value);
+        if (args.Value > 0) {
+            em->Enqueue<DamageEventArgs>(DamageEventArgs{args.Value - 1});
+        }
+    }
+
+    indie::event::EventManager *em;
+    std::vector<int> values;
+};
+
+TEST(Queue, Batches)
+{
+    indie::event::EventManager em;
+    Player p;
+    Healer h;
+    Echo e{&em, {}};
+
+    em.Register<HealEventArgs>(p);
+    em.Register<HealEventArgs>(h);
+    em.Register<DamageEventArgs>(e);
+
+    em.Enqueue<HealEventArgs>(HealEventArgs{1});
+    em.Enqueue<HealEventArgs>(HealEventArgs{2});
+    em.Enqueue<HealEventArgs>();
+    em.Enqueue<DamageEventArgs>(2);
+    ASSERT_EQ(em.Queued<HealEventArgs>(), 3u);
+    ASSERT_EQ(p.Hp, 100);
+
+    // Span observers receive the whole batch
+    em.Dispatch<HealEventArgs>();
+    ASSERT_EQ(p.Hp, 203);
+    ASSERT_EQ(h.batches, 1);
+    ASSERT_EQ(h.total, 103);
+    ASSERT_EQ(em.Queued<HealEventArgs>(), 0u);
+    ASSERT_EQ(em.Queued<DamageEventArgs>(), 1u);
+
+    // Subjects queued during a dispatch wait for the next one
+    em.Dispatch();
+    ASSERT_EQ(e.values, std::vector<int>({2}));
+    em.Dispatch();
+    em.Dispatch();
+    em.Dispatch();
+    ASSERT_EQ(e.values, std::vector<int>({2, 1, 0}));
+    ASSERT_EQ(h.batches, 1);
+}
+
+struct Recruit
+{
+    void OnReceive(DamageEventArgs &)
+    {
+        ++received;
+    }
+
+    int received{0};
+};
+
+struct Recruiter
+{
+    // Registers observers one subject at a time, growing the observers being delivered
+    void OnReceive(DamageEventArgs &)
+    {
+        for (int i = 0; i < 8; ++i) {
+            em->Register<DamageEventArgs>(recruits[registered++]);
+        }
+    }
+
+    indie::event::EventManager *em;
+    Recruit recruits[24];
+    int registered{0};
+};
+
+TEST(Queue, RegisterDuringDispatch)
+{
+    indie::event::EventManager em;
+    Recruiter recruiter{&em, {}, 0};
+
+    em.Register<DamageEventArgs>(recruiter);
+    em.Enqueue<DamageEventArgs>(1);
+    em.Enqueue<DamageEventArgs>(2);
+    em.Enqueue<DamageEventArgs>(3);
+    em.Dispatch();
+
+    // Observers registered during the dispatch receive the batch after the recruiter
+    ASSERT_EQ(recruiter.registered, 24);
+    for (auto &recruit : recruiter.recruits) {
+        ASSERT_EQ(recruit.received, 3);
+    }
+}
+
+struct Disbander
+{
+    // Removes every observer in the middle of the batch
+    void OnReceive(DamageEventArgs &)
+    {
+        if (++received == 2) {
+            em->Reset<DamageEventArgs>();
+        }
+    }
+
+    indie::event::EventManager *em;
+    int received{0};
+};
+
+TEST(Queue, ResetDuringDispatch)
+{
+    indie::event::EventManager em;
+    Recruit first;
+    Disbander disbander{&em, 0};
+    Recruit last;
+
+    em.Register<DamageEventArgs>(first);
+    em.Register<DamageEventArgs>(disbander);
+    em.Register<DamageEventArgs>(last);
+    for (int i = 0; i < 4; ++i) {
+        em.Enqueue<DamageEventArgs>(i);
+    }
+    em.Dispatch();
+
+    // Observers stop receiving at once, and are erased once the dispatch ends
+    ASSERT_EQ(first.received, 4);
+    ASSERT_EQ(disbander.received, 2);
+    ASSERT_EQ(last.received, 0);
+    ASSERT_FALSE(em.Has(&first));
+    ASSERT_FALSE(em.Has(&last));
+
+    em.Register<DamageEventArgs>(last);
+    em.Enqueue<DamageEventArgs>(5);
+    em.Dispatch();
+    ASSERT_EQ(first.received, 4);
+    ASSERT_EQ(last.received, 1);
+}
+
+TEST(Queue, NoSteadyStateAllocation)
+{
+    indie::event::EventManager em;
+    Player p;
+    Healer h;
+
+    em.Register<HealEventArgs>(p);
+    em.Register<HealEventArgs>(h);
+
+    for (int frame = 0; frame < 3; ++frame) {
+        for (int i = 0; i < 100; ++i) {
+            em.Enqueue<HealEventArgs>(HealEventArgs{1});
+        }
+        em.Dispatch();
+    }
+
+    auto before = allocations;
+    for (int frame = 0; frame < 10; ++frame) {
+        for (int i = 0; i < 100; ++i) {
+            em.Enqueue<HealEventArgs>(HealEventArgs{1});
+        }
+        em.Dispatch();
+    }
+    ASSERT_EQ(allocations, before);
+    ASSERT_EQ(h.total, 1300);
+}
+
+struct WalkEventArgs
+{
+    int Player;
+    int X;
+};
+
+struct ScoreEventArgs
+{
+    ScoreEventArgs &operator+=(const ScoreEventArgs &other) noexcept
+    {
+        Points += other.Points;
+        return *this;
+    }
+
+    int Player;
+    int Points;
+};
+
+struct AlertEventArgs
+{
+    int Zone;
+    int Level;
+};
+
+/**
+ * @brief Custom reducer, keeps the highest alert of a zone.
+ *
+ */
+struct KeepHighest
+{
+    static void Merge(AlertEventArgs &pending, AlertEventArgs &&incoming) noexcept
+    {
+        if (incoming.Level > pending.Level) {
+            pending = incoming;
+        }
+    }
+};
+
+template <>
+struct indie::event::Coalescing<WalkEventArgs> : indie::event::CoalesceBy<&WalkEventArgs::Player>
+{};
+template <>
+struct indie::event::Coalescing<ScoreEventArgs> : indie::event::CoalesceBy<&ScoreEventArgs::Player, indie::event::Accumulate>
+{};
+template <>
+struct indie::event::Coalescing<AlertEventArgs> : indie::event::CoalesceBy<&AlertEventArgs::Zone, KeepHighest>
+{};
+
+template <typename Subject>
+struct Recorder
+{
+    void OnReceive(indie::event::Span<Subject> events)
+    {
+        received.assign(events.begin(), events.end());
+    }
+
+    std::vector<Subject> received;
+};
+
+TEST(Queue, Coalescing)
+{
+    indie::event::EventManager em;
+    Recorder<WalkEventArgs> walks;
+    Recorder<ScoreEventArgs> scores;
+    Recorder<AlertEventArgs> alerts;
+
+    em.Register<WalkEventArgs>(walks);
+    em.Register<ScoreEventArgs>(scores);
+    em.Register<AlertEventArgs>(alerts);
+
+    // A subject keeps the position of the first one queued with its key
+    em.Enqueue<WalkEventArgs>(1, 10);
+    em.Enqueue<WalkEventArgs>(2, 20);
+    em.Enqueue<WalkEventArgs>(1, 11);
+    em.Enqueue<WalkEventArgs>(1, 12);
+    em.Enqueue<ScoreEventArgs>(1, 5);
+    em.Enqueue<ScoreEventArgs>(2, 1);
+    em.Enqueue<ScoreEventArgs>(1, 3);
+    em.Enqueue<AlertEventArgs>(7, 2);
+    em.Enqueue<AlertEventArgs>(7, 4);
+    em.Enqueue<AlertEventArgs>(7, 3);
+    ASSERT_EQ(em.Queued<WalkEventArgs>(), 2u);
+    ASSERT_EQ(em.Coalesced<WalkEventArgs>(), 2u);
+    ASSERT_EQ(em.Coalesced<HealEventArgs>(), 0u);
+
+    em.Dispatch();
+    ASSERT_EQ(walks.received.size(), 2u);
+    ASSERT_EQ(walks.received[0].Player, 1);
+    ASSERT_EQ(walks.received[0].X, 12);
+    ASSERT_EQ(walks.received[1].X, 20);
+    ASSERT_EQ(scores.received.size(), 2u);
+    ASSERT_EQ(scores.received[0].Points, 8);
+    ASSERT_EQ(scores.received[1].Points, 1);
+    ASSERT_EQ(alerts.received.size(), 1u);
+    ASSERT_EQ(alerts.received[0].Level, 4);
+    ASSERT_EQ(em.Coalesced<WalkEventArgs>(), 0u);
+
+    // Keys are forgotten by the dispatch
+    em.Enqueue<WalkEventArgs>(1, 13);
+    em.Dispatch();
+    ASSERT_EQ(walks.received.size(), 1u);
+    ASSERT_EQ(walks.received[0].X, 13);
+
+    // Many keys, no allocation once the index has grown
+    for (int frame = 0; frame < 3; ++frame) {
+        for (int i = 0; i < 1000; ++i) {
+            em.Enqueue<WalkEventArgs>(i % 100, i);
+        }
+        em.Dispatch();
+    }
+    walks.received.reserve(100);
+
+    auto before = allocations;
+    for (int frame = 0; frame < 10; ++frame) {
+        for (int i = 0; i < 1000; ++i) {
+            em.Enqueue<WalkEventArgs>(i % 100, i);
+        }
+        em.Dispatch();
+    }
+    ASSERT_EQ(allocations, before);
+    ASSERT_EQ(walks.received.size(), 100u);
+    ASSERT_EQ(walks.received[5].X, 905);
+}
+
+struct ChunkData
+{
+    int Tiles[1024];
+};
+
+struct ChunkEventArgs
+{
+    int X;
+    indie::event::Pooled<ChunkData> Data;
+};
+
+/**
+ * @brief Reads every chunk, keeps the last one of each batch.
+ *
+ */
+struct ChunkViewer
+{
+    void OnReceive(ChunkEventArgs &args)
+    {
+        total += args.Data->Tiles[args.X];
+        if (keep) {
+            last = args.Data;
+        }
+    }
+
+    bool keep{false};
+    int total{0};
+    indie::event::Pooled<ChunkData> last;
+};
+
+TEST(Payload, SharedByObservers)
+{
+    indie::event::EventManager em;
+    indie::event::PayloadPool<ChunkData> chunks{4};
+    ChunkViewer viewers[3];
+
+    for (auto &viewer : viewers) {
+        em.Register<ChunkEventArgs>(viewer);
+    }
+    viewers[0].keep = true;
+
+    auto data = chunks.Make();
+    data->Tiles[1] = 7;
+    em.Enqueue<ChunkEventArgs>(1, data);
+    ASSERT_EQ(data.References(), 2u);
+    data.Reset();
+    em.Enqueue<ChunkEventArgs>(2, chunks.Make());
+    ASSERT_EQ(chunks.Available(), 2u);
+
+    // Observers share the payloads, the ones not kept go back to the pool after the dispatch
+    em.Dispatch();
+    for (auto &viewer : viewers) {
+        ASSERT_EQ(viewer.total, 7);
+    }
+    ASSERT_EQ(viewers[0].last.References(), 1u);
+    ASSERT_EQ(chunks.Available(), 3u);
+    viewers[0].last.Reset();
+    ASSERT_EQ(chunks.Available(), chunks.Capacity());
+}
+
+TEST(Payload, NoSteadyStateAllocation)
+{
+    indie::event::EventManager em;
+    indie::event::PayloadPool<ChunkData> chunks;
+    ChunkViewer viewers[4];
+
+    for (auto &viewer : viewers) {
+        em.Register<ChunkEventArgs>(viewer);
+    }
+    viewers[2].keep = true;
+
+    for (int frame = 0; frame < 3; ++frame) {
+        for (int i = 0; i < 100; ++i) {
+            em.Enqueue<ChunkEventArgs>(i, chunks.Make());
+        }
+        em.Dispatch();
+    }
+
+    auto before = allocations;
+    auto capacity = chunks.Capacity();
+    for (int frame = 0; frame < 10; ++frame) {
+        for (int i = 0; i < 100; ++i) {
+            em.Enqueue<ChunkEventArgs>(0, chunks.Make(ChunkData{{i}}));
+        }
+        em.Dispatch();
+    }
+    ASSERT_EQ(allocations, before);
+    ASSERT_EQ(chunks.Capacity(), capacity);
+    ASSERT_EQ(viewers[0].total, 10 * 4950);
+    ASSERT_EQ(chunks.Available(), chunks.Capacity() - 1);
 }
\ No newline at end of file
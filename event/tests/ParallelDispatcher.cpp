@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <stdexcept>
+
+#include <indie/event/ParallelDispatcher.hpp>
+
+struct RankEventArgs
+{
+    int Player;
+    int Sequence;
+};
+
+struct CueEventArgs
+{
+    int Sequence;
+};
+
+template <>
+struct indie::event::Lanes<RankEventArgs> : indie::event::LaneBy<&RankEventArgs::Player>
+{};
+
+/**
+ * @brief Checks delivery order, each player is only touched by the lane of its key.
+ *
+ */
+struct Scoreboard
+{
+    void OnReceive(RankEventArgs &args)
+    {
+        auto &last = Last[static_cast<std::size_t>(args.Player)];
+
+        // Subjects of a key keep their order
+        Ordered = Ordered && args.Sequence == last + 1;
+        last = args.Sequence;
+        ++Scores;
+    }
+
+    void OnReceive(indie::event::Span<CueEventArgs> events)
+    {
+        for (auto &args : events) {
+            Ordered = Ordered && args.Sequence == LastCue + 1;
+            LastCue = args.Sequence;
+        }
+        Cues += events.Size();
+    }
+
+    std::vector<int> Last;
+    int LastCue{-1};
+    std::atomic<bool> Ordered{true};
+    std::atomic<std::size_t> Scores{0};
+    std::atomic<std::size_t> Cues{0};
+};
+
+TEST(ParallelDispatcher, Lanes)
+{
+    static constexpr int Players = 16;
+    static constexpr int Count = 1000;
+
+    for (std::size_t workers : {0, 1, 4}) {
+        indie::event::EventManager em;
+        indie::event::ParallelDispatcher parallel{em, workers};
+        Scoreboard board;
+        std::vector<int> sequences(Players, 0);
+
+        board.Last.assign(Players, -1);
+        em.Register<RankEventArgs, CueEventArgs>(board);
+        for (int frame = 0; frame < 3; ++frame) {
+            for (int i = 0; i < Count; ++i) {
+                em.Enqueue<RankEventArgs>(i % Players, sequences[i % Players]++);
+                em.Enqueue<CueEventArgs>(frame * Count + i);
+            }
+            parallel.Dispatch<RankEventArgs, CueEventArgs>();
+            parallel.Flush();
+            ASSERT_EQ(em.Queued<RankEventArgs>(), 0u);
+        }
+
+        ASSERT_EQ(parallel.Workers(), workers);
+        ASSERT_TRUE(board.Ordered);
+        ASSERT_EQ(board.Scores, 3u * Count);
+        ASSERT_EQ(board.Cues, 3u * Count);
+    }
+}
+
+/**
+ * @brief Holds the delivery until released by the test.
+ *
+ */
+struct HeldCue
+{
+    void OnReceive(CueEventArgs &)
+    {
+        while (!Released) {
+            std::this_thread::yield();
+        }
+        ++Received;
+    }
+
+    std::atomic<bool> Released{false};
+    std::atomic<int> Received{0};
+};
+
+TEST(ParallelDispatcher, Flush)
+{
+    indie::event::EventManager em;
+    indie::event::ParallelDispatcher parallel{em, 2};
+    HeldCue cue;
+
+    em.Register<CueEventArgs>(cue);
+    em.Enqueue<CueEventArgs>(0);
+    em.Enqueue<CueEventArgs>(1);
+    parallel.Dispatch<CueEventArgs>();
+
+    // Subjects queued during the delivery wait for the next dispatch
+    em.Enqueue<CueEventArgs>(2);
+    ASSERT_EQ(em.Queued<CueEventArgs>(), 1u);
+    em.Dispatch<CueEventArgs>();
+    parallel.Dispatch<CueEventArgs>();
+    ASSERT_EQ(em.Queued<CueEventArgs>(), 1u);
+
+    cue.Released = true;
+    parallel.Flush();
+    ASSERT_EQ(cue.Received, 2);
+
+    em.Dispatch<CueEventArgs>();
+    ASSERT_EQ(cue.Received, 3);
+}
+
+struct ThrowingCue
+{
+    void OnReceive(CueEventArgs &args)
+    {
+        if (args.Sequence == 1) {
+            throw std::runtime_error("cue");
+        }
+        ++Received;
+    }
+
+    std::atomic<int> Received{0};
+};
+
+TEST(ParallelDispatcher, Exception)
+{
+    indie::event::EventManager em;
+    indie::event::ParallelDispatcher parallel{em, 1};
+    ThrowingCue cue;
+
+    em.Register<CueEventArgs>(cue);
+    em.Enqueue<CueEventArgs>(1);
+    parallel.Dispatch<CueEventArgs>();
+    ASSERT_THROW(parallel.Flush(), std::runtime_error);
+
+    // The batch is released anyway
+    em.Enqueue<CueEventArgs>(2);
+    parallel.Dispatch<CueEventArgs>();
+    ASSERT_NO_THROW(parallel.Flush());
+    ASSERT_EQ(cue.Received, 1);
+}
\ No newline at end of file
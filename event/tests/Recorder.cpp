@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cstdio>
+#include <string>
+#include <fstream>
+
+#include <indie/event/Player.hpp>
+
+struct InputEventArgs
+{
+    int Player;
+    float X;
+};
+
+struct TextEventArgs
+{
+    std::string Text;
+};
+
+struct Replica
+{
+    void OnReceive(InputEventArgs &args)
+    {
+        inputs.push_back(args.Player * 100 + static_cast<int>(args.X));
+    }
+
+    void OnReceive(TextEventArgs &)
+    {
+        ++texts;
+    }
+
+    std::vector<int> inputs;
+    int texts{0};
+};
+
+static const char *RecordingPath = "indie_event_recorder_test.ievr";
+
+TEST(Recorder, RecordAndReplay)
+{
+    {
+        indie::event::EventManager em;
+        indie::event::Recorder recorder{RecordingPath};
+        Replica live;
+
+        recorder.Record<InputEventArgs>(7);
+        em.Register<InputEventArgs, TextEventArgs>(live);
+        em.Record(&recorder);
+
+        InputEventArgs input{1, 1};
+        TextEventArgs text{"not trivially copyable"};
+        em.Notify(input);
+        em.Notify(text);
+        recorder.SetTick(1);
+        em.Enqueue<InputEventArgs>(2, 2.f);
+        em.Enqueue<InputEventArgs>(3, 3.f);
+        em.Dispatch();
+        recorder.SetTick(4);
+        input.X = 4;
+        em.Notify(input);
+
+        // Not recorded once detached
+        em.Record(nullptr);
+        em.Notify(input);
+        ASSERT_EQ(recorder.Written(), 4u);
+        ASSERT_EQ(live.inputs.size(), 5u);
+    }
+
+    indie::event::EventManager em;
+    indie::event::Player player{RecordingPath};
+    Replica replica;
+
+    player.Bind<InputEventArgs>(7);
+    em.Register<InputEventArgs, TextEventArgs>(replica);
+
+    // Original timing
+    ASSERT_EQ(player.NextTick(), 0u);
+    ASSERT_EQ(player.Play(em, 0), 1u);
+    ASSERT_EQ(replica.inputs, std::vector<int>({101}));
+    ASSERT_EQ(player.Play(em, 1), 2u);
+    ASSERT_EQ(em.Queued<InputEventArgs>(), 2u);
+    em.Dispatch();
+    ASSERT_EQ(replica.inputs, std::vector<int>({101, 202, 303}));
+    ASSERT_EQ(player.Play(em, 3), 0u);
+    ASSERT_EQ(player.NextTick(), 4u);
+    ASSERT_EQ(player.Play(em, 4), 1u);
+    ASSERT_TRUE(player.Done());
+    ASSERT_EQ(replica.texts, 0);
+
+    // As fast as possible
+    player.Rewind();
+    replica.inputs.clear();
+    ASSERT_EQ(player.PlayAll(em), 4u);
+    em.Dispatch();
+    ASSERT_EQ(replica.inputs, std::vector<int>({101, 104, 202, 303}));
+
+    std::remove(RecordingPath);
+}
+
+TEST(Recorder, SubjectsWithoutObservers)
+{
+    {
+        indie::event::EventManager em;
+        indie::event::Recorder recorder{RecordingPath};
+        Replica live;
+
+        recorder.Record<InputEventArgs>(7);
+        em.Record(&recorder);
+
+        // Neither delivered nor recorded
+        InputEventArgs input{1, 1};
+        em.Enqueue<InputEventArgs>(2, 2.f);
+        em.Dispatch();
+        em.Register<InputEventArgs>(live);
+        em.Unregister(&live);
+        em.Notify(input);
+        em.Enqueue<InputEventArgs>(3, 3.f);
+        em.Dispatch();
+        ASSERT_EQ(recorder.Written(), 0u);
+
+        em.Register<InputEventArgs>(live);
+        em.Enqueue<InputEventArgs>(4, 4.f);
+        em.Dispatch();
+        ASSERT_EQ(recorder.Written(), 1u);
+        ASSERT_EQ(live.inputs, std::vector<int>({404}));
+    }
+
+    indie::event::EventManager em;
+    indie::event::Player player{RecordingPath};
+    Replica replica;
+
+    player.Bind<InputEventArgs>(7);
+    em.Register<InputEventArgs>(replica);
+    ASSERT_EQ(player.PlayAll(em), 1u);
+    em.Dispatch();
+    ASSERT_EQ(replica.inputs, std::vector<int>({404}));
+
+    std::remove(RecordingPath);
+}
+
+TEST(Recorder, InvalidFile)
+{
+    {
+        std::ofstream file{RecordingPath, std::ios::binary};
+        file << "not a recording";
+    }
+    ASSERT_THROW(indie::event::Player{RecordingPath}, std::runtime_error);
+    std::remove(RecordingPath);
+    ASSERT_THROW(indie::event::Player{RecordingPath}, std::runtime_error);
+}
\ No newline at end of file
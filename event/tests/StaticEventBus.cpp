@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <indie/event/StaticEventBus.hpp>
+
+struct SpawnEventArgs
+{
+    int Id;
+};
+
+struct ChatEventArgs
+{
+    int From;
+};
+
+/**
+ * @brief Compile-time handler of spawns, through its call operator.
+ *
+ */
+struct SpawnCounter
+{
+    void operator()(SpawnEventArgs &args)
+    {
+        ids.push_back(args.Id);
+    }
+
+    std::vector<int> ids;
+};
+
+/**
+ * @brief Compile-time handler of chat messages, by batch.
+ *
+ */
+struct ChatLog
+{
+    void OnReceive(indie::event::Span<ChatEventArgs> events)
+    {
+        ++batches;
+        count += events.Size();
+    }
+
+    int batches{0};
+    std::size_t count{0};
+};
+
+struct Spectator
+{
+    void OnReceive(SpawnEventArgs &)
+    {
+        ++spawns;
+    }
+
+    void OnReceive(ChatEventArgs &)
+    {
+        ++chats;
+    }
+
+    int spawns{0};
+    int chats{0};
+};
+
+using Bus = indie::event::StaticEventBus<indie::meta::TypeList<SpawnEventArgs, ChatEventArgs>, SpawnCounter, ChatLog>;
+
+TEST(StaticEventBus, Notify)
+{
+    Bus bus;
+    Spectator s;
+    SpawnEventArgs spawn{1};
+    ChatEventArgs chat{2};
+
+    static_assert(Bus::Handles<SpawnEventArgs>());
+    static_assert(!Bus::Handles<int>());
+
+    // Handlers receive subjects without registration
+    bus.Notify(spawn);
+    bus.Notify(chat);
+    ASSERT_EQ(bus.Get<SpawnCounter>().ids, std::vector<int>({1}));
+    ASSERT_EQ(bus.Get<ChatLog>().count, 1u);
+
+    bus.Register<SpawnEventArgs, ChatEventArgs>(s);
+    ASSERT_TRUE((bus.Has<SpawnEventArgs, ChatEventArgs>(s)));
+    bus.Notify(spawn);
+    bus.Notify(chat);
+    ASSERT_EQ(s.spawns, 1);
+    ASSERT_EQ(s.chats, 1);
+
+    bus.Unregister<ChatEventArgs>(s);
+    ASSERT_TRUE(bus.Has(s));
+    ASSERT_FALSE(bus.Has<ChatEventArgs>(s));
+    bus.Notify(chat);
+    ASSERT_EQ(s.chats, 1);
+
+    bus.Unregister(s);
+    ASSERT_FALSE(bus.Has(s));
+    bus.Notify(spawn);
+    ASSERT_EQ(s.spawns, 1);
+    ASSERT_EQ(bus.Get<SpawnCounter>().ids, std::vector<int>({1, 1, 1}));
+}
+
+TEST(StaticEventBus, Queue)
+{
+    Bus bus;
+    Spectator s;
+
+    bus.Register<SpawnEventArgs, ChatEventArgs>(s);
+    bus.Enqueue<SpawnEventArgs>(1);
+    bus.Enqueue<SpawnEventArgs>(2);
+    bus.Enqueue<ChatEventArgs>(3);
+    bus.Enqueue<ChatEventArgs>(4);
+    ASSERT_EQ(bus.Queued<ChatEventArgs>(), 2u);
+
+    bus.Dispatch<SpawnEventArgs>();
+    ASSERT_EQ(bus.Get<SpawnCounter>().ids, std::vector<int>({1, 2}));
+    ASSERT_EQ(s.spawns, 2);
+    ASSERT_EQ(s.chats, 0);
+
+    bus.Dispatch();
+    ASSERT_EQ(bus.Get<ChatLog>().batches, 1);
+    ASSERT_EQ(bus.Get<ChatLog>().count, 2u);
+    ASSERT_EQ(s.chats, 2);
+    ASSERT_EQ(bus.Queued<ChatEventArgs>(), 0u);
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <tuple>
+#include <utility>
+#include <cstdint>
 
 #include "TypeList.hpp"
 